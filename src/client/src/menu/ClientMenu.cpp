@@ -29,13 +29,9 @@ void ClientMenu::update() {
         _pendingActions.pop();
     }
 
-    auto& configs = _engine->getComponents<GameConfig>();
-    for (auto& config : configs)
-        if (config.has_value()) {
-            // we set the GameConfig here, if we change something in settings about keybinds, changement will be set
-            _engine->getRenderManager()->updateKeyBindings(config->_keybinds);
-            break;
-        }
+    // we set the GameConfig here, if we change something in settings about keybinds, changement will be set
+    if (const GameConfig* config = _engine->tryGetResource<GameConfig>())
+        _engine->getRenderManager()->updateKeyBindings(config->_keybinds);
 }
 
 void ClientMenu::createMainMenu()
@@ -164,13 +160,8 @@ void ClientMenu::createOptionMenu()
             MUSIC_ON_NONE_BUTTON, MUSIC_ON_HOVER_BUTTON, MUSIC_ON_CLICKED_BUTTON,
             [this]() {
                 this->_pendingActions.push([this]() {
-                    auto& configs = _engine->getComponents<GameConfig>();
-                    for (auto& config : configs) {
-                        if (config.has_value()) {
-                            config->musicEnabled = false;
-                            break;
-                        }
-                    }
+                    if (GameConfig* config = _engine->tryGetResource<GameConfig>())
+                        config->musicEnabled = false;
                     this->_musicOn = false;
                     this->clearMenuEntities(true);
                     this->createOptionMenu();
@@ -183,13 +174,8 @@ void ClientMenu::createOptionMenu()
             MUSIC_OFF_NONE_BUTTON, MUSIC_OFF_HOVER_BUTTON, MUSIC_OFF_CLICKED_BUTTON,
             [this]() {
                 this->_pendingActions.push([this]() {
-                    auto& configs = _engine->getComponents<GameConfig>();
-                    for (auto& config : configs) {
-                        if (config.has_value()) {
-                            config->musicEnabled = true;
-                            break;
-                        }
-                    }
+                    if (GameConfig* config = _engine->tryGetResource<GameConfig>())
+                        config->musicEnabled = true;
                     this->_musicOn = true;
                     this->clearMenuEntities(true);
                     this->createOptionMenu();
@@ -204,13 +190,8 @@ void ClientMenu::createOptionMenu()
             SOUND_ON_NONE_BUTTON, SOUND_ON_HOVER_BUTTON, SOUND_ON_CLICKED_BUTTON,
             [this]() {
                 this->_pendingActions.push([this]() {
-                    auto& configs = _engine->getComponents<GameConfig>();
-                    for (auto& config : configs) {
-                        if (config.has_value()) {
-                            config->soundEnabled = false;
-                            break;
-                        }
-                    }
+                    if (GameConfig* config = _engine->tryGetResource<GameConfig>())
+                        config->soundEnabled = false;
                     this->_soundOn = false;
                     this->clearMenuEntities(true);
                     this->createOptionMenu();
@@ -223,13 +204,8 @@ void ClientMenu::createOptionMenu()
             SOUND_OFF_NONE_BUTTON, SOUND_OFF_HOVER_BUTTON, SOUND_OFF_CLICKED_BUTTON,
             [this]() {
                 this->_pendingActions.push([this]() {
-                    auto& configs = _engine->getComponents<GameConfig>();
-                    for (auto& config : configs) {
-                        if (config.has_value()) {
-                            config->soundEnabled = true;
-                            break;
-                        }
-                    }
+                    if (GameConfig* config = _engine->tryGetResource<GameConfig>())
+                        config->soundEnabled = true;
 
                     this->_soundOn = true;
                     this->clearMenuEntities(true);
@@ -457,14 +433,8 @@ void ClientMenu::createAccessibilityMenu()
         DEFAULT_NONE_BUTTON, DEFAULT_HOVER_BUTTON, DEFAULT_CLICKED_BUTTON,
         [this]() {
             this->_pendingActions.push([this]() {
-                auto& configs = _engine->getComponents<GameConfig>();
-
-                for (auto& config : configs) {
-                    if (config.has_value()) {
-                        config->activeFont = FontAssets::DEFAULT_FONT;
-                        break;
-                    }
-                }
+                if (GameConfig* config = _engine->tryGetResource<GameConfig>())
+                    config->activeFont = FontAssets::DEFAULT_FONT;
             });
         }
     ));
@@ -474,14 +444,8 @@ void ClientMenu::createAccessibilityMenu()
         DEFAULT_NONE_BUTTON, DEFAULT_HOVER_BUTTON, DEFAULT_CLICKED_BUTTON,
         [this]() {
             this->_pendingActions.push([this]() {
-                auto& configs = _engine->getComponents<GameConfig>();
-
-                for (auto& config : configs) {
-                    if (config.has_value()) {
-                        config->activeFont = FontAssets::DYSLEXIC_FONT;
-                        break;
-                    }
-                }
+                if (GameConfig* config = _engine->tryGetResource<GameConfig>())
+                    config->activeFont = FontAssets::DYSLEXIC_FONT;
             });
         }
     ));
@@ -492,14 +456,8 @@ void ClientMenu::createAccessibilityMenu()
         DEFAULT_NONE_BUTTON, DEFAULT_HOVER_BUTTON, DEFAULT_CLICKED_BUTTON,
         [this]() {
             this->_pendingActions.push([this]() {
-                auto& configs = _engine->getComponents<GameConfig>();
-
-                for (auto& config : configs) {
-                    if (config.has_value()) {
-                        config->activeFont = FontAssets::DYSLEXIC_FONT_2;
-                        break;
-                    }
-                }
+                if (GameConfig* config = _engine->tryGetResource<GameConfig>())
+                    config->activeFont = FontAssets::DYSLEXIC_FONT_2;
             });
         }
     ));
@@ -510,14 +468,8 @@ void ClientMenu::createAccessibilityMenu()
         DEFAULT_NONE_BUTTON, DEFAULT_HOVER_BUTTON, DEFAULT_CLICKED_BUTTON,
         [this]() {
             this->_pendingActions.push([this]() {
-                auto& configs = _engine->getComponents<GameConfig>();
-
-                for (auto& config : configs) {
-                    if (config.has_value()) {
-                        config->activeFont = FontAssets::DYSLEXIC_FONT_3;
-                        break;
-                    }
-                }
+                if (GameConfig* config = _engine->tryGetResource<GameConfig>())
+                    config->activeFont = FontAssets::DYSLEXIC_FONT_3;
             });
         }
     ));
@@ -528,14 +480,8 @@ void ClientMenu::createAccessibilityMenu()
         DEFAULT_NONE_BUTTON, DEFAULT_HOVER_BUTTON, DEFAULT_CLICKED_BUTTON,
         [this]() {
             this->_pendingActions.push([this]() {
-                auto& configs = _engine->getComponents<GameConfig>();
-
-                for (auto& config : configs) {
-                    if (config.has_value()) {
-                        config->activeFont = FontAssets::DYSLEXIC_FONT_4;
-                        break;
-                    }
-                }
+                if (GameConfig* config = _engine->tryGetResource<GameConfig>())
+                    config->activeFont = FontAssets::DYSLEXIC_FONT_4;
             });
         }
     ));
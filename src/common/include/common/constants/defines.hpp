@@ -18,6 +18,9 @@
 #define TICK_RATE 16
 
 #define HEARTBEAT_TICK_INTERVAL 300
+#define SNAPSHOT_FULL_REFRESH_INTERVAL 60  // server snapshots between two full Health/Weapon refreshes
+#define ALLOCATION_REPORT_INTERVAL 600     // server ticks between two allocation reports (RTYPE_ALLOC_PROFILER builds)
+#define ALLOCATION_DUMP_PATH "allocations.json"
 #define INPUT_SEND_TICK_INTERVAL 2
 
 #define MAX_PLAYERS 32
@@ -449,6 +452,9 @@ enum NetworkType {
 
 // ================================ GAME ======================================
 
+// Side of a cell of the CollisionSystem broad phase grid, which covers the window
+#define COLLISION_GRID_CELL_SIZE 128.f
+
 // =============================== PLAYER =====================================
 
 #define PLAYER_SPRITE_WIDTH 33
@@ -485,6 +491,7 @@ enum NetworkType {
 #define SMALL_EXPLOSION_ANIMATION_START 0
 #define SMALL_EXPLOSION_ANIMATION_END 5
 #define SMALL_EXPLOSION_ANIMATION_LOOPING false
+#define SMALL_EXPLOSION_DURATION_MS 600     // Whole animation, sent in VISUAL_EFFECT packets
 
 // MEDIUM EXPLOSIONS
 #define MEDIUM_EXPLOSION_SPRITE_WIDTH 60
@@ -33,6 +33,11 @@ namespace ErrorMessages {
     constexpr const char *ECS_MISSING_SIGNATURE = "ECS error: System signature not defined.";
     constexpr const char *ECS_INVALID_ENTITY = "ECS error: Invalid or dead entity.";
     constexpr const char *ECS_COMPONENT_ACCESS_ERROR = "ECS error: Attempted to access a missing component.";
+    constexpr const char *ECS_TOO_MANY_SYSTEMS = "ECS error: Maximum number of systems reached.";
+    constexpr const char *ECS_PREFAB_NOT_FOUND = "ECS error: Requested prefab does not exist.";
+    constexpr const char *ECS_SNAPSHOT_EXPIRED = "ECS error: Snapshot handle is invalid or was overwritten.";
+    constexpr const char *ECS_SNAPSHOT_UNSUPPORTED = "ECS error: Snapshots require sparse-set storage and copyable components.";
+    constexpr const char *ECS_RESOURCE_NOT_FOUND = "ECS error: Requested resource does not exist.";
 
 }
 
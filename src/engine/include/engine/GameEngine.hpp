@@ -16,7 +16,11 @@
 #include <memory>
 #include <vector>
 #include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/entity/CommandBuffer.hpp>
+#include <engine/ecs/entity/Prefab.hpp>
+#include <engine/ecs/entity/PrefabRegistry.hpp>
 #include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/system/SystemPipeline.hpp>
 #include <engine/render/RenderManager.hpp>
 #include <engine/ecs/component/Components.hpp>
 #include <engine/audio/AudioManager.hpp>
@@ -27,9 +31,6 @@
  */
 namespace gameEngine {
 
-        struct ScoreEvent {
-        int32_t amount;
-    };
     /**
      * @class GameEngine
      * @brief The main facade of the engine. It coordinates the EntityManager, SystemManager, and RenderManager.
@@ -38,6 +39,7 @@ namespace gameEngine {
         private:
             std::shared_ptr<EntityManager> _entityManager; ///< Manager handling entity lifecycle and components.
             std::shared_ptr<SystemManager> _systemManager; ///< Manager handling system registration and updates.
+            std::shared_ptr<CommandBuffer> _commandBuffer; ///< Structural changes deferred until the next sync point.
             std::shared_ptr<RenderManager> _renderManager; ///< Manager handling windowing, inputs, and drawing.
             std::shared_ptr<audio::AudioManager> _audioManager;  ///< Manager handling musics and sounds effects.
 
@@ -50,13 +52,19 @@ namespace gameEngine {
             /**
              * @brief Initializes the GameEngine and its internal managers.
              * * This method must be called before any other operation. It instantiates the
-             * managers and links the SystemManager to the EntityManager.
+             * managers, links the SystemManager to the EntityManager and flushes the
+             * command buffer at every system sync point.
              */
             void init()
             {
-                this->_entityManager = std::make_unique<EntityManager>();
+                // Game systems index the sparse-set pools directly (getComponents())
+                this->_entityManager = std::make_unique<EntityManager>(StorageMode::SPARSE_SET);
                 this->_systemManager = std::make_unique<SystemManager>();
+                this->_commandBuffer = std::make_shared<CommandBuffer>(*this->_entityManager);
                 this->_entityManager->setSystemManager(this->_systemManager.get());
+                this->_systemManager->setSyncPoint([buffer = this->_commandBuffer.get()]() {
+                    buffer->flush();
+                });
             }
 
 
@@ -86,11 +94,11 @@ namespace gameEngine {
 
             /**
              * @brief Spawns a new entity in the engine.
-             * @param entityName A debug name for the entity.
+             * @param entityName A debug name for the entity (interned; compiled out with RTYPE_ENTITY_NAMES=OFF).
              * @param category The category of the entity (LOCAL or NETWORKED)
              * @return Entity The ID/Handle of the created entity.
              */
-            Entity createEntity(std::string entityName, EntityCategory category = EntityCategory::LOCAL)
+            Entity createEntity(EntityName entityName, EntityCategory category = EntityCategory::LOCAL)
             {
                 Entity entity = this->_entityManager->spawnEntity(entityName, category);
                 LOG_DEBUG_CAT("GameEngine", "Entity with ID {} created (category: {})", (std::size_t)entity, (int)category);
@@ -104,7 +112,7 @@ namespace gameEngine {
              * @param category The category of the entity (LOCAL or NETWORKED)
              * @return The created Entity
              */
-            Entity createEntityWithId(uint32_t id, std::string entityName, EntityCategory category = EntityCategory::NETWORKED)
+            Entity createEntityWithId(uint32_t id, EntityName entityName, EntityCategory category = EntityCategory::NETWORKED)
             {
                 Entity entity = this->_entityManager->spawnEntityWithId(id, entityName, category);
                 LOG_DEBUG_CAT("GameEngine", "Entity with ID {} created with specific ID (category: {})", id, (int)category);
@@ -154,9 +162,9 @@ namespace gameEngine {
 
             /**
              * @brief Get all networked entities.
-             * @return Reference to the set of networked entity IDs.
+             * @return Reference to the dense list of networked entity IDs.
              */
-            const std::unordered_set<std::size_t>& getNetworkedEntities() const
+            const std::vector<std::size_t>& getNetworkedEntities() const
             {
                 return this->_entityManager->getNetworkedEntities();
             }
@@ -171,6 +179,263 @@ namespace gameEngine {
                 this->_entityManager->killEntity(entity);
             }
 
+            /**
+             * @brief Removes an entity and all its associated components.
+             * * Does nothing if the handle is stale (the entity was already killed).
+             * @param entity The entity handle to destroy.
+             */
+            void destroyEntity(Entity const &entity)
+            {
+                this->_entityManager->killEntity(entity);
+            }
+
+            /**
+             * @brief Spawns count instances of a prefab at once.
+             * * IDs and storage are reserved once, each component type is written
+             * * to the whole batch in one pass, and every entity is matched
+             * * against systems once.
+             * @param count Number of entities to spawn.
+             * @param prefab The components given to every instance.
+             * @return std::vector<Entity> The created entities, in spawn order.
+             */
+            std::vector<Entity> spawnBatch(std::size_t count, const Prefab &prefab)
+            {
+                return spawnBatch(count, prefab, [](std::size_t, Entity) {});
+            }
+
+            /**
+             * @brief Spawns count instances of a prefab, then customizes each one.
+             * * init(index, entity) runs before the batch is matched against
+             * * systems, so per-instance values (position, IDs) can be written
+             * * without triggering extra signature updates.
+             * @param count Number of entities to spawn.
+             * @param prefab The components given to every instance.
+             * @param init Callable taking (std::size_t index, Entity entity).
+             * @return std::vector<Entity> The created entities, in spawn order.
+             */
+            template<class Init>
+            std::vector<Entity> spawnBatch(std::size_t count, const Prefab &prefab, Init &&init)
+            {
+                std::vector<Entity> entities;
+                this->_entityManager->holdSignatureUpdates();
+                try {
+                    entities = this->_entityManager->spawnEntities(count, prefab.getName(), prefab.getCategory());
+                    prefab.apply(*this->_entityManager, entities);
+                    for (std::size_t i = 0; i < entities.size(); ++i)
+                        init(i, entities[i]);
+                } catch (...) {
+                    this->_entityManager->releaseSignatureUpdates();
+                    throw;
+                }
+                this->_entityManager->releaseSignatureUpdates();
+                LOG_DEBUG_CAT("GameEngine", "Spawned {} entities from prefab {}", count, prefab.getName().view());
+                return entities;
+            }
+
+            /**
+             * @brief Gives an existing entity the default components of a prefab.
+             * * Used when the ID is imposed (network spawns); the entity is matched
+             * * against systems once, after init(entity) has written its
+             * * per-instance values.
+             * @param entity The entity to fill.
+             * @param prefab The components to copy.
+             * @param init Callable taking (Entity entity).
+             */
+            template<class Init>
+            void applyPrefab(Entity const &entity, const Prefab &prefab, Init &&init)
+            {
+                this->_entityManager->holdSignatureUpdates();
+                try {
+                    prefab.apply(*this->_entityManager, entity);
+                    init(entity);
+                } catch (...) {
+                    this->_entityManager->releaseSignatureUpdates();
+                    throw;
+                }
+                this->_entityManager->releaseSignatureUpdates();
+            }
+
+            /**
+             * @brief Gives an existing entity the default components of a prefab.
+             * @param entity The entity to fill.
+             * @param prefab The components to copy.
+             */
+            void applyPrefab(Entity const &entity, const Prefab &prefab)
+            {
+                applyPrefab(entity, prefab, [](Entity) {});
+            }
+
+            /**
+             * @brief Removes several entities, matching systems once for the whole batch.
+             * @param entities The entities to destroy (stale handles are skipped).
+             */
+            void killBatch(std::span<const Entity> entities)
+            {
+                this->_entityManager->killEntities(entities);
+            }
+
+            /**
+             * @brief Records a write made through a reference to an entity's component.
+             * * addComponent, emplaceComponent and updateComponent already record their writes.
+             * @tparam Component The type of the written component.
+             * @param entity The owner of the component.
+             */
+            template <class Component>
+            void markDirty(Entity const &entity)
+            {
+                this->_entityManager->template markDirty<Component>(entity);
+            }
+
+            /**
+             * @brief Gets the tick stamped on component writes made now.
+             * @return std::uint32_t The current change tick.
+             */
+            std::uint32_t getChangeTick() const
+            {
+                return this->_entityManager->getChangeTick();
+            }
+
+            /**
+             * @brief Starts a new change tick.
+             * @return std::uint32_t The new tick.
+             */
+            std::uint32_t advanceChangeTick()
+            {
+                return this->_entityManager->advanceChangeTick();
+            }
+
+            /**
+             * @brief Calls fn(entityId, component) for every component written after a tick.
+             * @tparam Component The component type to walk.
+             * @param tick The last tick already seen by the caller.
+             * @param fn Callable taking (std::size_t, Component&).
+             */
+            template <class Component, class Fn>
+            void forEachChangedSince(std::uint32_t tick, Fn &&fn)
+            {
+                this->_entityManager->template forEachChangedSince<Component>(tick, std::forward<Fn>(fn));
+            }
+
+            /**
+             * @brief Registers a callback run each time an entity gains a component.
+             * * Structural changes made from the callback must go through a CommandBuffer.
+             * @tparam Component The observed component type.
+             * @param fn Callable taking (Entity, Component&).
+             */
+            template <class Component, class Fn>
+            void onAdd(Fn &&fn)
+            {
+                this->_entityManager->template onAdd<Component>(std::forward<Fn>(fn));
+            }
+
+            /**
+             * @brief Registers a callback run when an existing component is overwritten or marked dirty.
+             * @tparam Component The observed component type.
+             * @param fn Callable taking (Entity, Component&).
+             */
+            template <class Component, class Fn>
+            void onSet(Fn &&fn)
+            {
+                this->_entityManager->template onSet<Component>(std::forward<Fn>(fn));
+            }
+
+            /**
+             * @brief Registers a callback run just before a component is removed, or its entity killed.
+             * @tparam Component The observed component type.
+             * @param fn Callable taking (Entity, Component&).
+             */
+            template <class Component, class Fn>
+            void onRemove(Fn &&fn)
+            {
+                this->_entityManager->template onRemove<Component>(std::forward<Fn>(fn));
+            }
+
+            /**
+             * @brief Stores a world resource (typed singleton kept outside the entity pools).
+             * * Replaces the previous instance of its type.
+             * @return Resource& The stored resource.
+             */
+            template <class Resource, class... Args>
+            Resource &insertResource(Args &&...args)
+            {
+                return this->_entityManager->template insertResource<Resource>(std::forward<Args>(args)...);
+            }
+
+            /**
+             * @brief Returns a world resource in O(1).
+             * @throws ErrorType::EcsComponentAccessError if no resource of this type was inserted.
+             */
+            template <class Resource>
+            Resource &getResource()
+            {
+                return this->_entityManager->template getResource<Resource>();
+            }
+
+            /**
+             * @brief Returns a world resource, or nullptr if none of this type was inserted.
+             */
+            template <class Resource>
+            Resource *tryGetResource()
+            {
+                return this->_entityManager->template tryGetResource<Resource>();
+            }
+
+            /**
+             * @brief Tells whether a world resource of this type is stored.
+             */
+            template <class Resource>
+            bool hasResource()
+            {
+                return this->_entityManager->template hasResource<Resource>();
+            }
+
+            /**
+             * @brief Destroys the world resource of this type, if any.
+             */
+            template <class Resource>
+            void removeResource()
+            {
+                this->_entityManager->template removeResource<Resource>();
+            }
+
+            /**
+             * @brief Captures the whole ECS world (components, resources, signatures, ID allocators).
+             * * Snapshots go to a ring of DEFAULT_SNAPSHOT_SLOTS buffers, the oldest is overwritten.
+             * @return SnapshotHandle The handle to pass to restoreState().
+             */
+            SnapshotHandle saveState()
+            {
+                return this->_entityManager->saveState();
+            }
+
+            /**
+             * @brief Rolls the ECS world back to a snapshot and re-matches the entities that changed.
+             * @param handle A handle returned by saveState() whose slot was not reused since.
+             */
+            void restoreState(SnapshotHandle handle)
+            {
+                this->_entityManager->restoreState(handle);
+            }
+
+            /**
+             * @brief Sets how many snapshots are kept before the oldest is overwritten.
+             * @param slots Number of ring slots (expires every handle).
+             */
+            void setSnapshotCapacity(std::size_t slots)
+            {
+                this->_entityManager->setSnapshotCapacity(slots);
+            }
+
+            /**
+             * @brief Gets the buffer systems record structural changes into.
+             * * Commands are applied after the recording system's onUpdate, see SystemManager::updateAll.
+             * @return CommandBuffer& The engine command buffer.
+             */
+            CommandBuffer &getCommandBuffer()
+            {
+                return *this->_commandBuffer;
+            }
+
             /**
              * @brief Checks if an entity still exists in the manager.
              * @param entity The entity to check.
@@ -184,9 +449,9 @@ namespace gameEngine {
             /**
              * @brief Gets the debug name assigned to an entity.
              * @param entity The target entity.
-             * @return std::string The name of the entity.
+             * @return std::string_view The name of the entity, valid for the whole program ("" when names are compiled out).
              */
-            std::string getEntityName(Entity const &entity) const
+            std::string_view getEntityName(Entity const &entity) const
             {
                 return this->_entityManager->getEntityName(entity);
             }
@@ -214,8 +479,7 @@ namespace gameEngine {
              * @return Reference to the newly added component.
              */
             template <class Component>
-            typename ComponentManager<Component>::referenceType
-            addComponent(Entity const &entity, Component component)
+            Component& addComponent(Entity const &entity, Component component)
             {
                 return this->_entityManager->template addComponent<Component>(entity, std::move(component));
             }
@@ -229,8 +493,7 @@ namespace gameEngine {
              * @return Reference to the newly created component.
              */
             template<class Component, class... Params>
-            typename ComponentManager<Component>::referenceType
-            emplaceComponent(Entity const &entity, Params&&... params)
+            Component& emplaceComponent(Entity const &entity, Params&&... params)
             {
                 return this->_entityManager->template emplaceComponent<Component>(entity, std::forward<Params>(params)...);
             }
@@ -269,6 +532,18 @@ namespace gameEngine {
                 return this->_entityManager->getComponents<Component>();
             }
 
+            /**
+             * @brief Gets a view over the entities owning all the given components.
+             * * Iterate it with each(), which hands out component references directly.
+             * @tparam Components The required component types.
+             * @return View<Components...> The view, backed by a cached match list.
+             */
+            template<typename... Components>
+            View<Components...> view() const
+            {
+                return this->_entityManager->template view<Components...>();
+            }
+
             /**
              * @brief Retrieves a specific component for a specific entity.
              * @tparam Component The type of component.
@@ -288,7 +563,7 @@ namespace gameEngine {
              */
             template <class Component>
             std::size_t getComponentTypeId() const {
-                return this->_entityManager->getComponentTypeID<Component>();
+                return this->_entityManager->template getComponentTypeId<Component>();
             }
 
 
@@ -323,6 +598,36 @@ namespace gameEngine {
                 return this->_systemManager->addSystem<System>(std::forward<Params>(params)...);
             }
 
+            /**
+             * @brief Registers a system to a stage, after the systems already in that stage.
+             * @tparam System The class of the system.
+             * @tparam Params Types of constructor arguments.
+             * @param stage Stage running the system (see SystemStage).
+             * @param params Arguments to initialize the system.
+             * @return System& Reference to the created system.
+             */
+            template<class System, class... Params>
+            System &registerSystem(SystemStage stage, Params &&... params)
+            {
+                return this->_systemManager->addSystem<System>(stage, std::forward<Params>(params)...);
+            }
+
+            /**
+             * @brief Builds a SystemPipeline: systems held by value and run in a fixed order by its update().
+             * * The systems are attached to the SystemManager (signatures, views and getSystem()
+             * work as usual) but updateSystems() does not run them. Destroy the pipeline before the engine.
+             * @tparam Systems The classes of the systems, in update order.
+             * @tparam ArgTuples Types of the constructor argument tuples.
+             * @param args One std::forward_as_tuple() of constructor arguments per system.
+             * @return std::unique_ptr<SystemPipeline<Systems...>> The pipeline.
+             */
+            template<class... Systems, class... ArgTuples>
+            std::unique_ptr<SystemPipeline<Systems...>> createPipeline(ArgTuples &&... args)
+            {
+                return std::make_unique<SystemPipeline<Systems...>>(*this->_entityManager, *this->_systemManager,
+                    std::forward<ArgTuples>(args)...);
+            }
+
             /**
              * @brief Retrieves a registered system.
              * @tparam System The class of the system.
@@ -383,6 +688,64 @@ namespace gameEngine {
                 _systemManager->setSignature<S>(sig);
             }
 
+            /**
+             * @brief Declares the components a system only reads.
+             * * Systems declaring their access may run in parallel (see setSchedulerMode).
+             * @tparam S The system type.
+             * @tparam Components The components read by the system.
+             */
+            template<class S, class... Components>
+            void setSystemReads()
+            {
+                Signature sig{};
+                (sig.set(_entityManager->template getComponentTypeId<Components>()), ...);
+                _systemManager->setReads<S>(sig);
+            }
+
+            /**
+             * @brief Declares the components a system writes.
+             * @tparam S The system type.
+             * @tparam Components The components written by the system.
+             */
+            template<class S, class... Components>
+            void setSystemWrites()
+            {
+                Signature sig{};
+                (sig.set(_entityManager->template getComponentTypeId<Components>()), ...);
+                _systemManager->setWrites<S>(sig);
+            }
+
+            /**
+             * @brief Selects how systems are updated.
+             * @param mode SEQUENTIAL (deterministic, one thread) or PARALLEL.
+             * @param threads Worker threads in PARALLEL mode (0 = hardware threads minus one).
+             */
+            void setSchedulerMode(SchedulerMode mode, size_t threads = 0)
+            {
+                _systemManager->setSchedulerMode(mode, threads);
+            }
+
+            /**
+             * @brief Runs every system of a stage at a fixed frequency.
+             * @param stage The stage to throttle.
+             * @param hz Steps per second (0 = every update).
+             */
+            void setStageRate(SystemStage stage, float hz)
+            {
+                _systemManager->setStageRate(stage, hz);
+            }
+
+            /**
+             * @brief Runs one system at a fixed frequency, e.g. ComponentUpdateFrequencies::AI_HZ.
+             * @tparam S The system type.
+             * @param hz Steps per second (0 = every update).
+             */
+            template<class S>
+            void setSystemRate(float hz)
+            {
+                _systemManager->setRate<S>(hz);
+            }
+
             // ################################################################
             // ########################### INPUTS #############################
             // ################################################################
@@ -682,12 +1045,6 @@ namespace gameEngine {
             {
                 this->_audioManager->update();
             }
-            /**
-             * @brief Structure representing a scoring event in the game.
-             */
-            std::vector<ScoreEvent>& scoreEvents() { return _scoreEvents;}
-        private:
-            std::vector<ScoreEvent> _scoreEvents;
     };
 }
 
@@ -0,0 +1,275 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** AllocationProfiler
+*/
+
+#ifndef ALLOCATIONPROFILER_HPP_
+#define ALLOCATIONPROFILER_HPP_
+
+#include <common/logger/Logger.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <ostream>
+
+/**
+ * @struct AllocationStats
+ * @brief Number of heap allocations and bytes requested.
+ */
+struct AllocationStats {
+    std::uint64_t count = 0;    /**< Calls to operator new */
+    std::uint64_t bytes = 0;    /**< Bytes requested */
+
+    AllocationStats operator-(const AllocationStats& other) const noexcept
+    {
+        return {count - other.count, bytes - other.bytes};
+    }
+
+    AllocationStats& operator+=(const AllocationStats& other) noexcept
+    {
+        count += other.count;
+        bytes += other.bytes;
+        return *this;
+    }
+};
+
+/**
+ * @class AllocationProfiler
+ * @brief Counts heap allocations per tick and per named scope (system, Coordinator phase).
+ *
+ * The counting itself is done by a replacement of the global operator new,
+ * compiled into the engine when the RTYPE_ALLOC_PROFILER CMake option is
+ * ON; otherwise ENABLED is false, the counters stay at zero and
+ * PROFILE_ALLOCATIONS() expands to nothing.
+ *
+ * Counters are per thread: a scope measures the thread it runs on, and a
+ * tick measures the thread calling beginTick()/endTick(). Systems run on
+ * workers (SchedulerMode::PARALLEL) only show up in their own scope.
+ *
+ * @code
+ * AllocationProfiler::beginTick();
+ * {
+ *     PROFILE_ALLOCATIONS("Coordinator::buildServerPacketBasedOnStatus");
+ *     coordinator.buildServerPacketBasedOnStatus(out, dt);
+ * }
+ * AllocationProfiler::endTick();
+ * AllocationProfiler::logReport();
+ * @endcode
+ */
+class AllocationProfiler {
+public:
+#ifdef RTYPE_ALLOC_PROFILER
+    static constexpr bool ENABLED = true;
+#else
+    static constexpr bool ENABLED = false;
+#endif
+    static constexpr std::size_t MAX_SCOPES = 128;  /**< Distinct scope names tracked, later ones are ignored */
+
+    /**
+     * @brief Records one allocation of the calling thread; called by the operator new hook.
+     */
+    static void recordAllocation(std::size_t bytes) noexcept
+    {
+        ++_thread.count;
+        _thread.bytes += bytes;
+    }
+
+    /**
+     * @brief Returns the allocations made by the calling thread since it started.
+     */
+    static AllocationStats threadTotals() noexcept
+    {
+        return _thread;
+    }
+
+    /**
+     * @brief Starts measuring a tick on the calling thread.
+     */
+    static void beginTick() noexcept
+    {
+        _tickStart = threadTotals();
+    }
+
+    /**
+     * @brief Ends the tick started by beginTick() and adds it to the tick statistics.
+     */
+    static void endTick() noexcept
+    {
+        AllocationStats tick = threadTotals() - _tickStart;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _lastTick = tick;
+        _allTicks += tick;
+        if (tick.count > _worstTick.count)
+            _worstTick = tick;
+        ++_ticks;
+    }
+
+    /**
+     * @brief Adds the allocations of one run of a scope.
+     * @param name Scope name; must outlive the profiler (string literal, typeid name).
+     */
+    static void addToScope(const char* name, const AllocationStats& delta) noexcept
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (std::size_t i = 0; i < _scopeCount; ++i) {
+            if (_scopes[i].name == name || std::strcmp(_scopes[i].name, name) == 0) {
+                _scopes[i].stats += delta;
+                ++_scopes[i].calls;
+                return;
+            }
+        }
+        if (_scopeCount < MAX_SCOPES)
+            _scopes[_scopeCount++] = Scope{name, delta, 1};
+    }
+
+    /** @return Allocations of the last tick */
+    static AllocationStats lastTick() noexcept
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _lastTick;
+    }
+
+    /** @return Allocations of every tick since the last reset() */
+    static AllocationStats allTicks() noexcept
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _allTicks;
+    }
+
+    /** @return Number of ticks since the last reset() */
+    static std::uint64_t tickCount() noexcept
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _ticks;
+    }
+
+    /**
+     * @brief Returns the allocations recorded by a scope since the last reset(), or zeros.
+     */
+    static AllocationStats scope(const char* name) noexcept
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (std::size_t i = 0; i < _scopeCount; ++i) {
+            if (std::strcmp(_scopes[i].name, name) == 0)
+                return _scopes[i].stats;
+        }
+        return {};
+    }
+
+    /**
+     * @brief Forgets the tick and scope statistics (e.g. once the warm-up is over).
+     */
+    static void reset() noexcept
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _lastTick = {};
+        _allTicks = {};
+        _worstTick = {};
+        _ticks = 0;
+        _scopeCount = 0;
+    }
+
+    /**
+     * @brief Logs the tick statistics, then the average per tick of every scope.
+     */
+    static void logReport()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::uint64_t ticks = _ticks > 0 ? _ticks : 1;
+        LOG_INFO_CAT("Allocations", "{} ticks: {} allocations ({} bytes), {:.1f}/tick, worst tick {} allocations",
+            _ticks, _allTicks.count, _allTicks.bytes, static_cast<double>(_allTicks.count) / ticks, _worstTick.count);
+        for (std::size_t i = 0; i < _scopeCount; ++i) {
+            const Scope& entry = _scopes[i];
+            LOG_INFO_CAT("Allocations", "  {}: {} allocations ({} bytes) in {} runs, {:.1f}/tick",
+                entry.name, entry.stats.count, entry.stats.bytes, entry.calls,
+                static_cast<double>(entry.stats.count) / ticks);
+        }
+    }
+
+    /**
+     * @brief Writes the statistics as one JSON object.
+     *
+     * {"enabled":true,"ticks":60,"total":{"count":0,"bytes":0},"worstTick":{...},
+     *  "scopes":[{"name":"...","count":0,"bytes":0,"calls":60}]}
+     */
+    static void dump(std::ostream& out)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        out << "{\"enabled\":" << (ENABLED ? "true" : "false")
+            << ",\"ticks\":" << _ticks
+            << ",\"total\":{\"count\":" << _allTicks.count << ",\"bytes\":" << _allTicks.bytes << '}'
+            << ",\"worstTick\":{\"count\":" << _worstTick.count << ",\"bytes\":" << _worstTick.bytes << '}'
+            << ",\"scopes\":[";
+        for (std::size_t i = 0; i < _scopeCount; ++i) {
+            const Scope& entry = _scopes[i];
+            out << (i ? "," : "") << "{\"name\":\"";
+            for (const char* c = entry.name; *c; ++c) {
+                if (*c == '"' || *c == '\\')
+                    out << '\\';
+                out << *c;
+            }
+            out << "\",\"count\":" << entry.stats.count << ",\"bytes\":" << entry.stats.bytes
+                << ",\"calls\":" << entry.calls << '}';
+        }
+        out << "]}\n";
+    }
+
+private:
+    struct Scope {
+        const char* name;
+        AllocationStats stats;
+        std::uint64_t calls;
+    };
+
+    inline static thread_local AllocationStats _thread{};       /**< Allocations of this thread */
+    inline static thread_local AllocationStats _tickStart{};    /**< Thread totals at beginTick() */
+
+    inline static std::mutex _mutex;                            /**< Guards everything below */
+    inline static AllocationStats _lastTick{};
+    inline static AllocationStats _allTicks{};
+    inline static AllocationStats _worstTick{};
+    inline static std::uint64_t _ticks = 0;
+    inline static std::array<Scope, MAX_SCOPES> _scopes{};      /**< Fixed storage: recording never allocates */
+    inline static std::size_t _scopeCount = 0;
+};
+
+/**
+ * @class AllocationScope
+ * @brief Adds the allocations made by the current thread during its lifetime to a named scope.
+ */
+class AllocationScope {
+public:
+    explicit AllocationScope(const char* name) noexcept
+        : _name(name), _start(AllocationProfiler::threadTotals()) {}
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+    ~AllocationScope()
+    {
+        AllocationProfiler::addToScope(_name, AllocationProfiler::threadTotals() - _start);
+    }
+
+private:
+    const char* _name;
+    AllocationStats _start;
+};
+
+#define ALLOCATION_PROFILER_CONCAT_(a, b) a##b
+#define ALLOCATION_PROFILER_CONCAT(a, b) ALLOCATION_PROFILER_CONCAT_(a, b)
+
+/**
+ * @brief Measures the rest of the enclosing block as a named scope; no code at all when the profiler is OFF.
+ */
+#ifdef RTYPE_ALLOC_PROFILER
+    #define PROFILE_ALLOCATIONS(name) AllocationScope ALLOCATION_PROFILER_CONCAT(allocationScope_, __LINE__)(name)
+#else
+    #define PROFILE_ALLOCATIONS(name) ((void)0)
+#endif
+
+#endif /* !ALLOCATIONPROFILER_HPP_ */
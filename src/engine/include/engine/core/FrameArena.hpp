@@ -0,0 +1,188 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** FrameArena
+*/
+
+#ifndef FRAMEARENA_HPP_
+#define FRAMEARENA_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+/**
+ * @class FrameArena
+ * @brief Linear allocator for memory that does not outlive the current tick.
+ *
+ * Allocation bumps a cursor in a chunk taken from the upstream resource;
+ * deallocation is a no-op (except for the most recent block, which is
+ * given back so that a growing vector reuses its own space). reset()
+ * frees everything at once and merges the chunks used during the frame
+ * into one, so after a few ticks a frame fits in a single chunk and the
+ * arena no longer touches the heap.
+ *
+ * Every thread owns one arena, reached through local(). nextFrame() ends
+ * the frame on all threads: each arena resets itself the next time its
+ * thread calls local(). Memory from local() must therefore be dropped
+ * before the tick ends and must not be handed to another thread.
+ *
+ * @code
+ * std::pmr::vector<std::size_t> toKill(&FrameArena::local());
+ * @endcode
+ */
+class FrameArena : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024; /**< Size of the first chunk */
+
+    /**
+     * @brief Creates an empty arena; no memory is taken before the first allocation.
+     * @param chunkSize Minimum size of a chunk.
+     * @param upstream Resource the chunks come from.
+     */
+    explicit FrameArena(std::size_t chunkSize = DEFAULT_CHUNK_SIZE,
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : _chunkSize(std::max<std::size_t>(chunkSize, 64)), _upstream(upstream) {}
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    ~FrameArena() override
+    {
+        release();
+    }
+
+    /**
+     * @brief Returns the arena of the calling thread, reset if a frame ended since its last use.
+     */
+    static FrameArena& local()
+    {
+        thread_local FrameArena arena;
+        std::uint64_t frame = _frame.load(std::memory_order_acquire);
+        if (arena._frameSeen != frame) {
+            arena.reset();
+            arena._frameSeen = frame;
+        }
+        return arena;
+    }
+
+    /**
+     * @brief Ends the current frame: every thread's arena is reset on its next local() call.
+     */
+    static void nextFrame() noexcept
+    {
+        _frame.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Frees every allocation and keeps one chunk large enough for the whole frame.
+     */
+    void reset()
+    {
+        if (_chunks.size() > 1) {
+            std::size_t total = 0;
+            for (const Chunk& chunk : _chunks)
+                total += chunk.size;
+            release();
+            addChunk(total);
+        }
+        if (!_chunks.empty())
+            _cursor = 0;
+        _used = 0;
+    }
+
+    /** @return Bytes handed out since the last reset */
+    std::size_t used() const noexcept { return _used; }
+
+    /** @return Bytes held in chunks */
+    std::size_t capacity() const noexcept
+    {
+        std::size_t total = 0;
+        for (const Chunk& chunk : _chunks)
+            total += chunk.size;
+        return total;
+    }
+
+    /** @return Number of chunks taken from the upstream resource since construction */
+    std::size_t upstreamAllocations() const noexcept { return _upstreamAllocations; }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        if (!_chunks.empty()) {
+            if (void* block = bump(_chunks.back(), bytes, alignment))
+                return block;
+        }
+        addChunk(std::max({_chunkSize, bytes + alignment, _chunks.empty() ? 0 : _chunks.back().size * 2}));
+        return bump(_chunks.back(), bytes, alignment);
+    }
+
+    void do_deallocate(void* block, std::size_t bytes, std::size_t) override
+    {
+        // Only the last block can be given back; the rest waits for reset()
+        if (_chunks.empty())
+            return;
+        std::byte* last = static_cast<std::byte*>(block);
+        if (last + bytes == _chunks.back().data + _cursor) {
+            _cursor = static_cast<std::size_t>(last - _chunks.back().data);
+            _used -= bytes;
+        }
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    struct Chunk {
+        std::byte* data;
+        std::size_t size;
+    };
+
+    /**
+     * @brief Carves an aligned block from the end of a chunk, or returns nullptr if it does not fit.
+     */
+    void* bump(const Chunk& chunk, std::size_t bytes, std::size_t alignment)
+    {
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(chunk.data);
+        std::uintptr_t aligned = (base + _cursor + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        std::size_t offset = aligned - base;
+        if (offset + bytes > chunk.size)
+            return nullptr;
+        _cursor = offset + bytes;
+        _used += bytes;
+        return chunk.data + offset;
+    }
+
+    void addChunk(std::size_t size)
+    {
+        _chunks.push_back({static_cast<std::byte*>(_upstream->allocate(size, alignof(std::max_align_t))), size});
+        _cursor = 0;
+        ++_upstreamAllocations;
+    }
+
+    void release()
+    {
+        for (const Chunk& chunk : _chunks)
+            _upstream->deallocate(chunk.data, chunk.size, alignof(std::max_align_t));
+        _chunks.clear();
+        _cursor = 0;
+    }
+
+    std::size_t _chunkSize;                     /**< Minimum chunk size */
+    std::pmr::memory_resource* _upstream;       /**< Source of the chunks */
+    std::vector<Chunk> _chunks;                 /**< Chunks of the current frame, the last one is being filled */
+    std::size_t _cursor = 0;                    /**< First free byte of the last chunk */
+    std::size_t _used = 0;                      /**< Bytes handed out since the last reset */
+    std::size_t _upstreamAllocations = 0;       /**< Chunks taken so far */
+    std::uint64_t _frameSeen = 0;               /**< Frame the arena was last reset for (see local()) */
+
+    inline static std::atomic<std::uint64_t> _frame{0}; /**< Frames ended by nextFrame() */
+};
+
+#endif /* !FRAMEARENA_HPP_ */
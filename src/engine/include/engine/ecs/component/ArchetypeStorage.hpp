@@ -0,0 +1,423 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** ArchetypeStorage
+*/
+
+#ifndef ARCHETYPESTORAGE_HPP_
+#define ARCHETYPESTORAGE_HPP_
+
+#include <engine/ecs/Signature.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @class ArchetypeStorage
+ * @brief Stores components grouped by archetype (set of component types), in fixed-size SoA chunks.
+ *
+ * Every entity owning exactly the same component types lives in the same
+ * archetype. An archetype splits its rows into chunks of CHUNK_SIZE bytes,
+ * and each chunk holds one contiguous column per component type, so walking
+ * Transform + Velocity + Sprite reads three dense arrays side by side.
+ *
+ * Adding or removing a component moves the entity's row to the archetype
+ * of its new signature (the moves are cached on an edge per component type).
+ * Removing a row moves the last row of the archetype into the hole, so
+ * references to components are invalidated by any structural change.
+ *
+ * Component types are identified by the dense IDs the EntityManager uses as
+ * Signature bits. Entities owning no component are not stored.
+ */
+class ArchetypeStorage {
+public:
+    static constexpr std::size_t CHUNK_SIZE = 16 * 1024;                                /**< Bytes per chunk */
+    static constexpr std::uint32_t NPOS = std::numeric_limits<std::uint32_t>::max();   /**< No archetype / no column */
+
+private:
+    /**
+     * @brief Type-erased operations needed to relocate a component of a given type.
+     */
+    struct TypeInfo {
+        std::size_t size = 0;
+        void (*moveConstruct)(void* dst, void* src) = nullptr;
+        void (*destroy)(void* ptr) = nullptr;
+    };
+
+    /**
+     * @brief Archetype and row holding an entity.
+     */
+    struct Location {
+        std::uint32_t archetype = NPOS;
+        std::uint32_t row = 0;
+    };
+
+    /**
+     * @brief Rows of every entity owning exactly one set of component types.
+     */
+    struct Archetype {
+        Signature signature;
+        std::vector<std::size_t> types;                     /**< Component type of each column, ascending */
+        std::vector<std::size_t> sizes;                     /**< Component size of each column */
+        std::vector<std::size_t> offsets;                   /**< Byte offset of each column inside a chunk */
+        std::array<std::uint32_t, MAX_COMPONENTS> columnOf; /**< Column of each component type, or NPOS */
+        std::array<std::uint32_t, MAX_COMPONENTS> edges;    /**< Archetype reached by toggling a type, or NPOS */
+        std::size_t capacity = 0;                           /**< Rows per chunk */
+        std::size_t chunkBytes = 0;                         /**< Allocation size of a chunk */
+        std::vector<std::unique_ptr<std::byte[]>> chunks;   /**< Column storage, capacity rows each */
+        std::vector<std::size_t> entities;                  /**< Entity of each row */
+
+        void* at(std::size_t column, std::size_t row) const
+        {
+            return chunks[row / capacity].get() + offsets[column] + (row % capacity) * sizes[column];
+        }
+    };
+
+public:
+    ArchetypeStorage() = default;
+    ArchetypeStorage(const ArchetypeStorage&) = delete;
+    ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+
+    ~ArchetypeStorage()
+    {
+        for (Archetype& archetype : _archetypes) {
+            for (std::size_t row = 0; row < archetype.entities.size(); ++row)
+                destroyRow(archetype, row);
+        }
+    }
+
+    /**
+     * @brief Records how to move and destroy a component type.
+     * @param type Component type ID (Signature bit).
+     */
+    template <class Component>
+    void registerType(std::size_t type)
+    {
+        static_assert(alignof(Component) <= alignof(std::max_align_t),
+            "Over-aligned components are not supported by the archetype storage");
+
+        if (type >= _types.size())
+            _types.resize(type + 1);
+        if (_types[type].size != 0)
+            return;
+        _types[type].size = sizeof(Component);
+        _types[type].moveConstruct = [](void* dst, void* src) {
+            new (dst) Component(std::move(*std::launder(static_cast<Component*>(src))));
+        };
+        _types[type].destroy = [](void* ptr) {
+            std::launder(static_cast<Component*>(ptr))->~Component();
+        };
+    }
+
+    /**
+     * @brief Constructs a component for an entity, moving the entity to its new archetype.
+     *
+     * If the entity already owns the component, it is replaced.
+     * @param entity Entity ID.
+     * @param type Component type ID.
+     * @return Reference to the stored component.
+     */
+    template <class Component, class... Params>
+    Component& emplace(std::size_t entity, std::size_t type, Params&&... params)
+    {
+        registerType<Component>(type);
+
+        if (Component* existing = tryGet<Component>(entity, type)) {
+            *existing = Component(std::forward<Params>(params)...);
+            return *existing;
+        }
+
+        if (entity >= _locations.size())
+            _locations.resize(entity + 1);
+        Location from = _locations[entity];
+        std::uint32_t target = from.archetype == NPOS ? archetypeFor(Signature().set(type)) : neighbour(from.archetype, type);
+
+        std::uint32_t row = pushRow(target, entity);
+        Archetype& to = _archetypes[target];
+        if (from.archetype != NPOS)
+            moveShared(_archetypes[from.archetype], from.row, to, row);
+        void* slot = to.at(to.columnOf[type], row);
+        Component* component = new (slot) Component(std::forward<Params>(params)...);
+
+        if (from.archetype != NPOS)
+            removeRow(from.archetype, from.row);
+        _locations[entity] = {target, row};
+        return *component;
+    }
+
+    /**
+     * @brief Stores a component for an entity (see emplace()).
+     */
+    template <class Component>
+    Component& insert(std::size_t entity, std::size_t type, Component&& component)
+    {
+        return emplace<std::decay_t<Component>>(entity, type, std::forward<Component>(component));
+    }
+
+    /**
+     * @brief Removes one component from an entity, moving the entity to its new archetype.
+     * @param entity Entity ID.
+     * @param type Component type ID.
+     */
+    void remove(std::size_t entity, std::size_t type)
+    {
+        if (!contains(entity, type))
+            return;
+
+        Location from = _locations[entity];
+        Signature remaining = _archetypes[from.archetype].signature;
+        remaining.reset(type);
+        if (remaining.none()) {
+            erase(entity);
+            return;
+        }
+
+        std::uint32_t target = neighbour(from.archetype, type);
+        std::uint32_t row = pushRow(target, entity);
+        moveShared(_archetypes[from.archetype], from.row, _archetypes[target], row);
+        removeRow(from.archetype, from.row);
+        _locations[entity] = {target, row};
+    }
+
+    /**
+     * @brief Removes every component of an entity.
+     */
+    void erase(std::size_t entity)
+    {
+        if (entity >= _locations.size() || _locations[entity].archetype == NPOS)
+            return;
+        Location from = _locations[entity];
+        removeRow(from.archetype, from.row);
+        _locations[entity] = Location();
+    }
+
+    /**
+     * @brief Checks whether an entity owns a component type.
+     */
+    bool contains(std::size_t entity, std::size_t type) const
+    {
+        if (entity >= _locations.size() || _locations[entity].archetype == NPOS || type >= MAX_COMPONENTS)
+            return false;
+        return _archetypes[_locations[entity].archetype].signature.test(type);
+    }
+
+    /**
+     * @brief Returns a pointer to an entity's component, or nullptr when absent.
+     */
+    template <class Component>
+    Component* tryGet(std::size_t entity, std::size_t type) const
+    {
+        if (!contains(entity, type))
+            return nullptr;
+        const Location& location = _locations[entity];
+        const Archetype& archetype = _archetypes[location.archetype];
+        return std::launder(static_cast<Component*>(archetype.at(archetype.columnOf[type], location.row)));
+    }
+
+    /**
+     * @brief Calls fn(entityId, Components&...) for every entity owning all the given types.
+     *
+     * Matching archetypes are walked chunk by chunk, each column as a plain array.
+     * @param types Component type ID of each of Components.
+     * @param fn Callable taking (std::size_t, Components&...).
+     */
+    template <class... Components, class Fn>
+    void each(const std::array<std::size_t, sizeof...(Components)>& types, Fn&& fn) const
+    {
+        Signature required;
+        for (std::size_t type : types)
+            required.set(type);
+
+        for (const Archetype& archetype : _archetypes) {
+            if (archetype.entities.empty() || (archetype.signature & required) != required)
+                continue;
+            eachInArchetype<Components...>(archetype, types, fn, std::index_sequence_for<Components...>{});
+        }
+    }
+
+    /**
+     * @brief Returns the number of entities owning all the given types.
+     */
+    template <std::size_t N>
+    std::size_t count(const std::array<std::size_t, N>& types) const
+    {
+        Signature required;
+        for (std::size_t type : types)
+            required.set(type);
+
+        std::size_t total = 0;
+        for (const Archetype& archetype : _archetypes) {
+            if ((archetype.signature & required) == required)
+                total += archetype.entities.size();
+        }
+        return total;
+    }
+
+    /** @return Number of archetypes created so far */
+    std::size_t archetypeCount() const noexcept { return _archetypes.size(); }
+
+    /** @return Number of chunks allocated over all archetypes */
+    std::size_t chunkCount() const noexcept
+    {
+        std::size_t total = 0;
+        for (const Archetype& archetype : _archetypes)
+            total += archetype.chunks.size();
+        return total;
+    }
+
+private:
+    template <class... Components, class Fn, std::size_t... I>
+    static void eachInArchetype(const Archetype& archetype, const std::array<std::size_t, sizeof...(Components)>& types,
+        Fn& fn, std::index_sequence<I...>)
+    {
+        const std::size_t columns[] = {archetype.columnOf[types[I]]...};
+        const std::size_t rows = archetype.entities.size();
+
+        for (std::size_t chunk = 0; chunk * archetype.capacity < rows; ++chunk) {
+            std::byte* base = archetype.chunks[chunk].get();
+            const std::size_t first = chunk * archetype.capacity;
+            const std::size_t count = std::min(archetype.capacity, rows - first);
+            const std::size_t* entities = archetype.entities.data() + first;
+            std::tuple<Components*...> arrays{
+                std::launder(reinterpret_cast<Components*>(base + archetype.offsets[columns[I]]))...};
+
+            for (std::size_t row = 0; row < count; ++row)
+                fn(entities[row], std::get<I>(arrays)[row]...);
+        }
+    }
+
+    /**
+     * @brief Returns the archetype of a signature, creating it (and its chunk layout) if needed.
+     */
+    std::uint32_t archetypeFor(const Signature& signature)
+    {
+        auto it = _archetypeIndex.find(signature);
+        if (it != _archetypeIndex.end())
+            return it->second;
+
+        Archetype archetype;
+        archetype.signature = signature;
+        archetype.columnOf.fill(NPOS);
+        archetype.edges.fill(NPOS);
+
+        std::size_t rowBytes = 0;
+        for (std::size_t type = 0; type < MAX_COMPONENTS; ++type) {
+            if (!signature.test(type))
+                continue;
+            archetype.columnOf[type] = static_cast<std::uint32_t>(archetype.types.size());
+            archetype.types.push_back(type);
+            archetype.sizes.push_back(_types[type].size);
+            rowBytes += _types[type].size;
+        }
+
+        // Columns start on max_align_t boundaries; shrink the row count until they fit.
+        constexpr std::size_t ALIGN = alignof(std::max_align_t);
+        archetype.capacity = std::max<std::size_t>(1, CHUNK_SIZE / std::max<std::size_t>(1, rowBytes));
+        for (;;) {
+            std::size_t offset = 0;
+            archetype.offsets.clear();
+            for (std::size_t size : archetype.sizes) {
+                archetype.offsets.push_back(offset);
+                offset += (size * archetype.capacity + ALIGN - 1) / ALIGN * ALIGN;
+            }
+            if (offset <= CHUNK_SIZE || archetype.capacity == 1) {
+                archetype.chunkBytes = std::max(offset, ALIGN);
+                break;
+            }
+            --archetype.capacity;
+        }
+
+        std::uint32_t index = static_cast<std::uint32_t>(_archetypes.size());
+        _archetypes.push_back(std::move(archetype));
+        _archetypeIndex.emplace(signature, index);
+        return index;
+    }
+
+    /**
+     * @brief Returns the archetype reached by adding or removing one type, following the cached edge.
+     */
+    std::uint32_t neighbour(std::uint32_t archetype, std::size_t type)
+    {
+        std::uint32_t next = _archetypes[archetype].edges[type];
+        if (next != NPOS)
+            return next;
+
+        Signature signature = _archetypes[archetype].signature;
+        signature.flip(type);
+        next = archetypeFor(signature);
+        _archetypes[archetype].edges[type] = next;
+        _archetypes[next].edges[type] = archetype;
+        return next;
+    }
+
+    /**
+     * @brief Reserves a row at the end of an archetype, allocating a chunk if needed.
+     */
+    std::uint32_t pushRow(std::uint32_t index, std::size_t entity)
+    {
+        Archetype& archetype = _archetypes[index];
+        std::size_t row = archetype.entities.size();
+        if (row / archetype.capacity >= archetype.chunks.size())
+            archetype.chunks.push_back(std::make_unique<std::byte[]>(archetype.chunkBytes));
+        archetype.entities.push_back(entity);
+        return static_cast<std::uint32_t>(row);
+    }
+
+    /**
+     * @brief Move-constructs into a new row every component the two archetypes have in common.
+     */
+    void moveShared(Archetype& from, std::size_t fromRow, Archetype& to, std::size_t toRow)
+    {
+        for (std::size_t column = 0; column < from.types.size(); ++column) {
+            std::size_t type = from.types[column];
+            if (to.columnOf[type] != NPOS)
+                _types[type].moveConstruct(to.at(to.columnOf[type], toRow), from.at(column, fromRow));
+        }
+    }
+
+    void destroyRow(Archetype& archetype, std::size_t row)
+    {
+        for (std::size_t column = 0; column < archetype.types.size(); ++column)
+            _types[archetype.types[column]].destroy(archetype.at(column, row));
+    }
+
+    /**
+     * @brief Destroys a row and fills the hole with the last row of the archetype.
+     */
+    void removeRow(std::uint32_t index, std::size_t row)
+    {
+        Archetype& archetype = _archetypes[index];
+        std::size_t last = archetype.entities.size() - 1;
+
+        destroyRow(archetype, row);
+        if (row != last) {
+            for (std::size_t column = 0; column < archetype.types.size(); ++column) {
+                const TypeInfo& info = _types[archetype.types[column]];
+                info.moveConstruct(archetype.at(column, row), archetype.at(column, last));
+                info.destroy(archetype.at(column, last));
+            }
+            archetype.entities[row] = archetype.entities[last];
+            _locations[archetype.entities[row]].row = static_cast<std::uint32_t>(row);
+        }
+        archetype.entities.pop_back();
+    }
+
+private:
+    std::vector<TypeInfo> _types;                                /**< Operations per component type ID */
+    std::vector<Archetype> _archetypes;                          /**< Archetypes in creation order */
+    std::unordered_map<Signature, std::uint32_t> _archetypeIndex; /**< Archetype of each signature */
+    std::vector<Location> _locations;                            /**< Row of each entity */
+};
+
+#endif /* !ARCHETYPESTORAGE_HPP_ */
@@ -8,19 +8,42 @@
 #ifndef COMPONENTMANAGER_HPP_
 #define COMPONENTMANAGER_HPP_
 
+#include <engine/ecs/component/SnapshotTraits.hpp>
+
 #include <optional>
 #include <vector>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
 
 /**
  * @class ComponentManager
  * @brief Stores and manages all components of a specific type.
  *
+ * Storage is a sparse set:
+ *  - a dense packed array of components (only live components are stored);
+ *  - a dense array holding the entity ID owning each packed component;
+ *  - a paged sparse index mapping entity IDs to packed positions.
+ *
+ * Sparse pages are only allocated for the ID ranges actually used, so a pool
+ * holding one networked entity (IDs >= NETWORKED_ID_OFFSET) no longer pays
+ * for thousands of empty slots. Removal is a swap-and-pop: it is O(1) but it
+ * invalidates references to the last packed component.
+ *
+ * Each packed component also carries the change tick of its last write:
+ * insertion, emplacement and markChanged() stamp it with the tick of the
+ * clock shared by the EntityManager (see setChangeClock()), so consumers can
+ * walk only the components changed since the tick they last looked at.
+ * Writes through references are not seen: call markChanged() after them.
+ *
  * Responsibilities:
- *  - maintain a dense array of optional components indexed by entity ID;
- *  - automatically expand when needed;
  *  - provide insertion, emplacement, retrieval, and removal operations;
- *  - offer iterator access over all component slots.
+ *  - offer indexed access by entity ID (returning an empty slot when absent);
+ *  - offer packed iteration over live components only;
+ *  - record the change tick of every live component.
  *
  * This class contains no logic related to systems or signatures.
  *
@@ -32,12 +55,31 @@ public:
     using valueType = std::optional<Component>;        /**< Optional component slot */
     using referenceType = valueType&;                  /**< Mutable reference to a component slot */
     using constReferenceType = const valueType&;       /**< Const reference to a component slot */
-    using containerT = std::vector<valueType>;         /**< Internal container type */
+    using containerT = std::vector<valueType>;         /**< Packed container type */
     using sizeType = typename containerT::size_type;   /**< Size/index type */
 
-    using iterator = typename containerT::iterator;            /**< Iterator over component slots */
+    using iterator = typename containerT::iterator;            /**< Iterator over packed component slots */
     using constIterator = typename containerT::const_iterator; /**< Const iterator */
 
+    static constexpr sizeType PAGE_SIZE = 4096;                                        /**< Sparse entries per page */
+    static constexpr std::uint32_t NPOS = std::numeric_limits<std::uint32_t>::max();   /**< Empty sparse entry */
+    static constexpr std::uint32_t NEVER_CHANGED = 0;                                  /**< Change tick of an absent component */
+
+    /**
+     * @struct Snapshot
+     * @brief Copy of the packed storage, filled by saveTo() and read back by restoreFrom().
+     *
+     * Keep one alive and reuse it: its buffers keep their capacity, so once
+     * they have grown to the pool's size saving no longer allocates. Change
+     * ticks are not captured: restored components count as changed at the
+     * restore tick.
+     */
+    struct Snapshot {
+        containerT dense;                   /**< Packed components */
+        std::vector<std::size_t> entities;  /**< Owning entity of each packed component */
+        sizeType extent = 0;                /**< Addressable entity range */
+    };
+
 public:
     /** @brief Default constructor */
     ComponentManager() = default;
@@ -58,58 +100,221 @@ public:
     ComponentManager& operator=(ComponentManager&&) noexcept = default;
 
     /**
-     * @brief Access a component slot by index.
+     * @brief Access a component slot by entity ID.
+     *
+     * Never allocates: an absent component yields the shared read-only
+     * empty slot of the const overload. Never write through it; add a
+     * component with insertAt() or emplaceAt().
      * @param idx Entity ID.
-     * @return Reference to the optional component at this index.
+     * @return Reference to the optional component of this entity.
      */
     referenceType operator[](size_t idx) {
-        ensureSize(idx);
-        return _data[idx];
+        std::uint32_t dense = denseIndex(idx);
+        if (dense == NPOS)
+            return const_cast<referenceType>(emptySlot());
+        return _dense[dense];
     }
 
     /**
      * @brief Const-qualified access to a component slot.
      */
     constReferenceType operator[](size_t idx) const {
-        if (idx >= _data.size()) {
-            static std::optional<Component> empty;
-            return empty;
-        }
-        return _data[idx];
+        std::uint32_t dense = denseIndex(idx);
+        if (dense == NPOS)
+            return emptySlot();
+        return _dense[dense];
     }
 
-    /** @return Iterator to the beginning of the internal storage */
-    iterator begin() { return _data.begin(); }
+    /** @return Iterator to the beginning of the packed storage */
+    iterator begin() { return _dense.begin(); }
 
-    /** @return Const iterator to the beginning of the internal storage */
-    constIterator begin() const { return _data.begin(); }
+    /** @return Const iterator to the beginning of the packed storage */
+    constIterator begin() const { return _dense.begin(); }
 
-    /** @return Const iterator to the beginning of the internal storage */
-    constIterator cbegin() const { return _data.cbegin(); }
+    /** @return Const iterator to the beginning of the packed storage */
+    constIterator cbegin() const { return _dense.cbegin(); }
 
-    /** @return Iterator to the end of the internal storage */
-    iterator end() { return _data.end(); }
+    /** @return Iterator to the end of the packed storage */
+    iterator end() { return _dense.end(); }
 
-    /** @return Const iterator to the end of the internal storage */
-    constIterator end() const { return _data.end(); }
+    /** @return Const iterator to the end of the packed storage */
+    constIterator end() const { return _dense.end(); }
 
-    /** @return Const iterator to the end of the internal storage */
-    constIterator cend() const { return _data.cend(); }
+    /** @return Const iterator to the end of the packed storage */
+    constIterator cend() const { return _dense.cend(); }
 
     /**
-     * @brief Returns the number of allocated component slots.
+     * @brief Returns the addressable entity range (highest stored ID + 1).
+     *
+     * Kept for index-based loops (`for (e = 0; e < size(); ++e)`);
+     * use packedSize() to know how many components are actually stored.
      */
     sizeType size() const {
-        return _data.size();
+        return _extent;
+    }
+
+    /**
+     * @brief Returns the number of live components.
+     */
+    sizeType packedSize() const {
+        return _dense.size();
+    }
+
+    /**
+     * @brief Returns the entity IDs owning each packed component, in packed order.
+     */
+    const std::vector<std::size_t>& packedEntities() const {
+        return _entities;
+    }
+
+    /**
+     * @brief Access a live component by packed position.
+     * @param pos Position inside the packed array (< packedSize()).
+     */
+    Component& packedAt(sizeType pos) {
+        return *_dense[pos];
+    }
+
+    /**
+     * @brief Const version of packedAt().
+     */
+    const Component& packedAt(sizeType pos) const {
+        return *_dense[pos];
+    }
+
+    /**
+     * @brief Calls fn(entityId, component) for every live component.
+     *
+     * The pool must not be structurally modified during the walk.
+     * @param fn Callable taking (std::size_t, Component&).
+     */
+    template <class Fn>
+    void forEach(Fn&& fn) {
+        for (sizeType i = 0; i < _dense.size(); ++i)
+            fn(_entities[i], *_dense[i]);
     }
 
     /**
-     * @brief Ensures the internal vector can hold at least pos+1 entries.
+     * @brief Const version of forEach().
+     */
+    template <class Fn>
+    void forEach(Fn&& fn) const {
+        for (sizeType i = 0; i < _dense.size(); ++i)
+            fn(_entities[i], *_dense[i]);
+    }
+
+    /**
+     * @brief Checks whether an entity owns a component in this pool.
+     */
+    bool contains(sizeType pos) const {
+        return denseIndex(pos) != NPOS;
+    }
+
+    /**
+     * @brief Returns a pointer to an entity's component, or nullptr when absent.
+     */
+    Component* tryGet(sizeType pos) {
+        std::uint32_t dense = denseIndex(pos);
+        return dense == NPOS ? nullptr : &*_dense[dense];
+    }
+
+    /**
+     * @brief Const version of tryGet().
+     */
+    const Component* tryGet(sizeType pos) const {
+        std::uint32_t dense = denseIndex(pos);
+        return dense == NPOS ? nullptr : &*_dense[dense];
+    }
+
+    /**
+     * @brief Returns an entity's component without any presence check.
+     *
+     * Only valid for an entity known to own the component (e.g. one taken
+     * from a View match list); otherwise the behaviour is undefined.
+     */
+    Component& get(sizeType pos) {
+        return *_dense[_sparse[pos / PAGE_SIZE][pos % PAGE_SIZE]];
+    }
+
+    /**
+     * @brief Const version of get().
+     */
+    const Component& get(sizeType pos) const {
+        return *_dense[_sparse[pos / PAGE_SIZE][pos % PAGE_SIZE]];
+    }
+
+    /**
+     * @brief Ensures the sparse index can address entity ID pos.
      * @param pos Required index.
      */
     void ensureSize(sizeType pos) {
-        if (pos >= _data.size())
-            _data.resize(pos + 1);
+        sparseSlot(pos);
+    }
+
+    /**
+     * @brief Shares the tick stamped on every write.
+     *
+     * Without a clock (a pool used on its own) every write is stamped with tick 1.
+     * @param clock Current change tick, owned by the EntityManager.
+     */
+    void setChangeClock(std::shared_ptr<const std::uint32_t> clock) {
+        _clock = std::move(clock);
+    }
+
+    /**
+     * @brief Returns the tick stamped on writes made now.
+     */
+    std::uint32_t currentTick() const {
+        return _clock ? *_clock : 1;
+    }
+
+    /**
+     * @brief Records a write made through a reference to an entity's component.
+     * @param pos Entity ID (ignored if the entity has no component in this pool).
+     */
+    void markChanged(sizeType pos) {
+        std::uint32_t dense = denseIndex(pos);
+        if (dense != NPOS)
+            _ticks[dense] = currentTick();
+    }
+
+    /**
+     * @brief Returns the tick of the last write to an entity's component, or NEVER_CHANGED if absent.
+     */
+    std::uint32_t changeTick(sizeType pos) const {
+        std::uint32_t dense = denseIndex(pos);
+        return dense == NPOS ? NEVER_CHANGED : _ticks[dense];
+    }
+
+    /**
+     * @brief Calls fn(entityId, component) for every component written after a tick.
+     *
+     * The pool must not be structurally modified during the walk.
+     * @param tick The last tick the caller has already seen (NEVER_CHANGED walks everything).
+     * @param fn Callable taking (std::size_t, Component&).
+     */
+    template <class Fn>
+    void forEachChangedSince(std::uint32_t tick, Fn&& fn) {
+        for (sizeType i = 0; i < _dense.size(); ++i) {
+            if (_ticks[i] > tick)
+                fn(_entities[i], *_dense[i]);
+        }
+    }
+
+    /**
+     * @brief Returns the number of components the packed storage holds without reallocating.
+     */
+    sizeType capacity() const {
+        return _dense.capacity();
+    }
+
+    /**
+     * @brief Reserves packed capacity for n components.
+     */
+    void reserve(sizeType n) {
+        _dense.reserve(n);
+        _entities.reserve(n);
+        _ticks.reserve(n);
     }
 
     /**
@@ -119,9 +324,13 @@ public:
      * @return Reference to the optional component slot.
      */
     referenceType insertAt(sizeType pos, const Component& c) {
-        ensureSize(pos);
-        _data[pos] = c;
-        return _data[pos];
+        std::uint32_t& slot = sparseSlot(pos);
+        if (slot != NPOS) {
+            _dense[slot] = c;
+            _ticks[slot] = currentTick();
+            return _dense[slot];
+        }
+        return pushBack(slot, pos, c);
     }
 
     /**
@@ -131,9 +340,13 @@ public:
      * @return Reference to the optional component slot.
      */
     referenceType insertAt(sizeType pos, Component&& c) {
-        ensureSize(pos);
-        _data[pos] = std::move(c);
-        return _data[pos];
+        std::uint32_t& slot = sparseSlot(pos);
+        if (slot != NPOS) {
+            _dense[slot] = std::move(c);
+            _ticks[slot] = currentTick();
+            return _dense[slot];
+        }
+        return pushBack(slot, pos, std::move(c));
     }
 
     /**
@@ -145,32 +358,179 @@ public:
      */
     template <class... Params>
     referenceType emplaceAt(sizeType pos, Params&&... args) {
-        ensureSize(pos);
-        _data[pos].reset();
-        _data[pos].emplace(std::forward<Params>(args)...);
-        return _data[pos];
+        std::uint32_t& slot = sparseSlot(pos);
+        if (slot != NPOS) {
+            _dense[slot].reset();
+            _dense[slot].emplace(std::forward<Params>(args)...);
+            _ticks[slot] = currentTick();
+            return _dense[slot];
+        }
+        slot = static_cast<std::uint32_t>(_dense.size());
+        _entities.push_back(pos);
+        _ticks.push_back(currentTick());
+        _dense.emplace_back(std::in_place, std::forward<Params>(args)...);
+        return _dense.back();
     }
 
     /**
-     * @brief Removes the component at the given index.
+     * @brief Removes the component at the given index (swap-and-pop).
      * @param pos Entity ID.
      */
     void erase(sizeType pos) {
-        if (pos < _data.size() && _data[pos])
-            _data[pos].reset();
+        std::uint32_t dense = denseIndex(pos);
+        if (dense == NPOS)
+            return;
+
+        std::uint32_t last = static_cast<std::uint32_t>(_dense.size() - 1);
+        if (dense != last) {
+            _dense[dense] = std::move(_dense[last]);
+            _entities[dense] = _entities[last];
+            _ticks[dense] = _ticks[last];
+            _sparse[_entities[dense] / PAGE_SIZE][_entities[dense] % PAGE_SIZE] = dense;
+        }
+        _dense.pop_back();
+        _entities.pop_back();
+        _ticks.pop_back();
+        _sparse[pos / PAGE_SIZE][pos % PAGE_SIZE] = NPOS;
+    }
+
+    /**
+     * @brief Removes every component, keeping the allocated storage.
+     */
+    void clear() {
+        for (std::size_t entity : _entities)
+            _sparse[entity / PAGE_SIZE][entity % PAGE_SIZE] = NPOS;
+        _dense.clear();
+        _entities.clear();
+        _ticks.clear();
+    }
+
+    /**
+     * @brief Copies the live components into a snapshot.
+     *
+     * Trivially copyable components are copied with one memcpy, the others
+     * through SnapshotTraits<Component>::copy().
+     * @param out The snapshot to overwrite.
+     */
+    void saveTo(Snapshot& out) const {
+        copyPacked(_dense, out.dense);
+        out.entities.assign(_entities.begin(), _entities.end());
+        out.extent = _extent;
     }
 
     /**
-     * @brief Computes the array index of a component slot.
-     * @param v Reference to a component slot.
-     * @return The index of the slot inside the internal vector.
+     * @brief Replaces the live components with the content of a snapshot.
+     *
+     * References to components of this pool are invalidated.
+     * @param in A snapshot filled by saveTo() on this pool.
+     */
+    void restoreFrom(const Snapshot& in) {
+        copyPacked(in.dense, _dense);
+        // The sparse index only needs rebuilding if components were added or removed since the save
+        if (_entities != in.entities) {
+            for (std::size_t entity : _entities)
+                _sparse[entity / PAGE_SIZE][entity % PAGE_SIZE] = NPOS;
+            _entities.assign(in.entities.begin(), in.entities.end());
+            for (sizeType i = 0; i < _entities.size(); ++i)
+                sparseSlot(_entities[i]) = static_cast<std::uint32_t>(i);
+        }
+        _ticks.assign(_entities.size(), currentTick());
+        if (in.extent > _extent)
+            _extent = in.extent;
+    }
+
+    /**
+     * @brief Returns the entity ID owning a component slot.
+     * @param v Reference to a packed component slot.
+     * @return The entity ID, as the old dense layout used to report.
      */
     sizeType getIndex(const valueType& v) const {
-        return &v - _data.data();
+        return _entities[&v - _dense.data()];
+    }
+
+    /**
+     * @brief Approximate heap footprint of this pool, in bytes.
+     */
+    sizeType memoryUsage() const {
+        sizeType bytes = _dense.capacity() * sizeof(valueType)
+            + _entities.capacity() * sizeof(std::size_t)
+            + _ticks.capacity() * sizeof(std::uint32_t)
+            + _sparse.capacity() * sizeof(std::vector<std::uint32_t>);
+        for (const auto& page : _sparse)
+            bytes += page.capacity() * sizeof(std::uint32_t);
+        return bytes;
+    }
+
+private:
+    /**
+     * @brief Read-only slot returned for absent entities, shared by every lookup.
+     */
+    static constReferenceType emptySlot() {
+        static const valueType empty;
+        return empty;
+    }
+
+    /**
+     * @brief Looks up the packed position of an entity without allocating.
+     */
+    std::uint32_t denseIndex(sizeType pos) const {
+        sizeType page = pos / PAGE_SIZE;
+        if (page >= _sparse.size() || _sparse[page].empty())
+            return NPOS;
+        return _sparse[page][pos % PAGE_SIZE];
+    }
+
+    /**
+     * @brief Returns the sparse entry of an entity, allocating its page if needed.
+     */
+    std::uint32_t& sparseSlot(sizeType pos) {
+        sizeType page = pos / PAGE_SIZE;
+        if (page >= _sparse.size())
+            _sparse.resize(page + 1);
+        if (_sparse[page].empty())
+            _sparse[page].assign(PAGE_SIZE, NPOS);
+        if (pos >= _extent)
+            _extent = pos + 1;
+        return _sparse[page][pos % PAGE_SIZE];
+    }
+
+    /**
+     * @brief Appends a new packed component and records it in the sparse index.
+     */
+    template <class C>
+    referenceType pushBack(std::uint32_t& slot, sizeType pos, C&& c) {
+        slot = static_cast<std::uint32_t>(_dense.size());
+        _entities.push_back(pos);
+        _ticks.push_back(currentTick());
+        _dense.emplace_back(std::forward<C>(c));
+        return _dense.back();
+    }
+
+    /**
+     * @brief Makes `to` an exact copy of the packed slots `from`.
+     */
+    static void copyPacked(const containerT& from, containerT& to) {
+        if constexpr (SnapshotTraits<Component>::BITWISE) {
+            to.resize(from.size());
+            if (!from.empty())
+                std::memcpy(static_cast<void*>(to.data()), from.data(), from.size() * sizeof(valueType));
+        } else {
+            if (to.size() > from.size())
+                to.erase(to.begin() + static_cast<std::ptrdiff_t>(from.size()), to.end());
+            for (sizeType i = 0; i < to.size(); ++i)
+                SnapshotTraits<Component>::copy(*from[i], to[i]);
+            for (sizeType i = to.size(); i < from.size(); ++i)
+                SnapshotTraits<Component>::copy(*from[i], to.emplace_back());
+        }
     }
 
 private:
-    containerT _data; /**< Internal storage for optional components */
+    containerT _dense;                                 /**< Packed live components */
+    std::vector<std::size_t> _entities;                /**< Owning entity of each packed component */
+    std::vector<std::uint32_t> _ticks;                 /**< Change tick of each packed component */
+    std::shared_ptr<const std::uint32_t> _clock;       /**< Current change tick, shared with the EntityManager */
+    std::vector<std::vector<std::uint32_t>> _sparse;   /**< Paged entity -> packed index (empty page = unallocated) */
+    sizeType _extent = 0;                              /**< Highest addressed entity ID + 1 */
 };
 
 #endif /* !COMPONENTMANAGER_HPP_ */
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** ComponentPool
+*/
+
+#ifndef COMPONENTPOOL_HPP_
+#define COMPONENTPOOL_HPP_
+
+#include <engine/ecs/component/ComponentManager.hpp>
+#include <common/error/Error.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class IComponentPool
+ * @brief Type-erased handle on a ComponentManager, stored in the EntityManager registry.
+ *
+ * Only the operations that must run without knowing the component type
+ * (i.e. cleanup on entity destruction, world snapshots) go through the
+ * virtual interface.
+ */
+class IComponentPool {
+public:
+    virtual ~IComponentPool() = default;
+
+    /**
+     * @brief Removes the component owned by an entity, if any.
+     * @param entity Entity ID.
+     */
+    virtual void erase(std::size_t entity) = 0;
+
+    /**
+     * @brief Removes every component.
+     */
+    virtual void clear() = 0;
+
+    /**
+     * @brief Copies the pool into one slot of its snapshot ring.
+     * @param slot Ring slot, grown on first use.
+     */
+    virtual void save(std::size_t slot) = 0;
+
+    /**
+     * @brief Replaces the pool content with a slot previously filled by save().
+     * @param slot Ring slot.
+     */
+    virtual void restore(std::size_t slot) = 0;
+};
+
+/**
+ * @class ComponentPool
+ * @brief Registry entry owning the ComponentManager of one component type.
+ *
+ * @tparam Component The type of component stored.
+ */
+template <typename Component>
+class ComponentPool : public IComponentPool {
+public:
+    void erase(std::size_t entity) override { components.erase(entity); }
+
+    void clear() override { components.clear(); }
+
+    void save(std::size_t slot) override
+    {
+        if constexpr (std::is_copy_constructible_v<Component>) {
+            if (slot >= snapshots.size())
+                snapshots.resize(slot + 1);
+            components.saveTo(snapshots[slot]);
+        } else {
+            throw Error(ErrorType::EcsError, ErrorMessages::ECS_SNAPSHOT_UNSUPPORTED);
+        }
+    }
+
+    void restore(std::size_t slot) override
+    {
+        if constexpr (std::is_copy_constructible_v<Component>)
+            components.restoreFrom(snapshots[slot]);
+        else
+            throw Error(ErrorType::EcsError, ErrorMessages::ECS_SNAPSHOT_UNSUPPORTED);
+    }
+
+    ComponentManager<Component> components;    /**< Storage of this component type */
+    std::vector<typename ComponentManager<Component>::Snapshot> snapshots;    /**< Snapshot ring, indexed like the EntityManager's */
+};
+
+#endif /* !COMPONENTPOOL_HPP_ */
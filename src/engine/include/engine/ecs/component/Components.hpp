@@ -90,12 +90,85 @@ struct NetworkId {
 // ############################################################################
 
 /**
- * @brief Defines a rectangular collision area.
+ * @brief Shape of a HitBox.
+ */
+enum class HitBoxShape : uint8_t {
+    AABB,
+    CIRCLE
+};
+
+/**
+ * @brief Defines the collision area of an entity, relative to its Transform.
+ *
+ * Sizes and offsets are in unscaled units and multiplied by Transform::scale.
+ * A box starts at (x + offsetX, y + offsetY); a circle is centered there.
+ * A default HitBox (zero-sized box) takes the size of the entity's Sprite
+ * rect, if any, and never collides otherwise.
  *
  * Used by: CollisionSystem.
  */
 struct HitBox
 {
+    HitBoxShape shape = HitBoxShape::AABB;
+    float offsetX = 0.f;
+    float offsetY = 0.f;
+    float width = 0.f;      /**< AABB width, 0 to use the Sprite rect */
+    float height = 0.f;     /**< AABB height, 0 to use the Sprite rect */
+    float radius = 0.f;     /**< CIRCLE radius */
+
+    static HitBox box(float width, float height, float offsetX = 0.f, float offsetY = 0.f)
+    {
+        return HitBox{HitBoxShape::AABB, offsetX, offsetY, width, height, 0.f};
+    }
+
+    static HitBox circle(float radius, float offsetX = 0.f, float offsetY = 0.f)
+    {
+        return HitBox{HitBoxShape::CIRCLE, offsetX, offsetY, 0.f, 0.f, radius};
+    }
+};
+
+/**
+ * @brief What a collision means for gameplay.
+ */
+enum class CollisionKind : uint8_t {
+    PROJECTILE_HIT,     // a: projectile, b: the entity it may damage
+    CONTACT             // a: player, b: enemy or boss it touches
+};
+
+/**
+ * @brief One gameplay collision found by CollisionSystem (entity IDs).
+ */
+struct CollisionEvent {
+    uint32_t a;
+    uint32_t b;
+    CollisionKind kind;
+    float time = 0.f;           // When in the tick they start overlapping, 0 (start) to 1 (end)
+};
+
+/**
+ * @brief Outcome of a collision on its target, written by DamageSystem.
+ */
+struct HitEvent {
+    uint32_t target;
+    uint32_t source;            // Projectile or touching player
+    CollisionKind kind;         // PROJECTILE_HIT: the source is spent
+    int32_t damage;             // Damage of the hit, also when the target's Health is spared
+    bool playerHit;             // The target is a player (score penalty, no Health loss)
+    bool killed;                // The target's Health dropped to 0
+    bool bounty;                // Killed an ENEMY or BOSS on behalf of the PLAYER team
+    float x, y;                 // Target position when hit
+};
+
+/**
+ * @brief World resource: collisions of the current tick and their outcomes.
+ *
+ * CollisionSystem clears it and appends `collisions`, earliest first;
+ * DamageSystem resolves them in order into `hits`; ScoreSystem, DestroySystem and the server's
+ * packet builder (PLAYER_HIT, VISUAL_EFFECT) each read `hits` in one batch.
+ */
+struct CollisionEvents {
+    std::vector<CollisionEvent> collisions;
+    std::vector<HitEvent> hits;
 };
 
 
@@ -523,6 +596,18 @@ struct Score {
     uint32_t score = 0;
 };
 
+/**
+ * @brief World resource of the HUD score (see GameEngine::insertResource()).
+ *
+ * Score changes are queued in `events` (ScoreSystem::pushEvent()) and applied
+ * once per frame by ScoreSystem, which then shows the total on the `hud` entity.
+ */
+struct ScoreBoard {
+    uint32_t score = 0;
+    std::vector<int32_t> events;            // Pending score changes of the frame
+    Entity hud = Entity::fromId(0);         // Entity displaying the score, 0 if none
+};
+
 
 // ############################################################################
 // ################################# AUDIO ####################################
@@ -839,11 +924,11 @@ struct Force
 // ############################################################################
 
 /**
- * @brief GameConfig component.
+ * @brief GameConfig world resource (see GameEngine::insertResource()).
  *
- * Only ONE entity has this component assigned when Game is created.
- * Let know the game from the entity if music/sound are enabled or for keybinds.
- * Used by: AccessibilitySystem, RebindSystem.
+ * Inserted once when Game is created, read with GameEngine::tryGetResource().
+ * Let know the game if music/sound are enabled, the active font and the keybinds.
+ * Used by: AccessibilitySystem, RebindSystem, RenderSystem, AudioSystem.
  */
 struct GameConfig {
     FontAssets activeFont;
@@ -0,0 +1,200 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** ResourceStorage
+*/
+
+#ifndef RESOURCESTORAGE_HPP_
+#define RESOURCESTORAGE_HPP_
+
+#include <engine/ecs/component/SnapshotTraits.hpp>
+#include <common/error/Error.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @class IResourceSlot
+ * @brief Type-erased handle on the slot of one resource type, for world snapshots.
+ */
+class IResourceSlot {
+public:
+    virtual ~IResourceSlot() = default;
+
+    /**
+     * @brief Copies the resource (or its absence) into one slot of the snapshot ring.
+     * @param slot Ring slot, grown on first use.
+     */
+    virtual void save(std::size_t slot) = 0;
+
+    /**
+     * @brief Puts back the resource captured by save(); a slot never saved removes it.
+     * @param slot Ring slot.
+     */
+    virtual void restore(std::size_t slot) = 0;
+};
+
+/**
+ * @class ResourceSlot
+ * @brief Holds the single instance of one resource type and its snapshot ring.
+ *
+ * @tparam Resource The resource type.
+ */
+template <class Resource>
+class ResourceSlot : public IResourceSlot {
+public:
+    void save(std::size_t slot) override
+    {
+        if constexpr (std::is_copy_constructible_v<Resource>) {
+            if (slot >= snapshots.size())
+                snapshots.resize(slot + 1);
+            if (value)
+                SnapshotTraits<Resource>::copy(*value, snapshots[slot]);
+            else
+                snapshots[slot].reset();
+        } else {
+            throw Error(ErrorType::EcsError, ErrorMessages::ECS_SNAPSHOT_UNSUPPORTED);
+        }
+    }
+
+    void restore(std::size_t slot) override
+    {
+        if constexpr (std::is_copy_constructible_v<Resource>) {
+            if (slot < snapshots.size() && snapshots[slot])
+                SnapshotTraits<Resource>::copy(*snapshots[slot], value);
+            else
+                value.reset();
+        } else {
+            throw Error(ErrorType::EcsError, ErrorMessages::ECS_SNAPSHOT_UNSUPPORTED);
+        }
+    }
+
+    std::optional<Resource> value;                      /**< The resource, empty until inserted */
+    std::vector<std::optional<Resource>> snapshots;     /**< Snapshot ring, indexed like the EntityManager's */
+};
+
+/**
+ * @class ResourceStorage
+ * @brief World resources: typed singletons (configuration, score, current level...)
+ *        stored outside the entity pools.
+ *
+ * Each resource type gets a dense ID on first use, so every access is one
+ * vector index, whatever the number of entities. A type has at most one
+ * instance per storage. Resources are not part of any signature and are
+ * never seen by systems' entity lists; systems read them directly.
+ */
+class ResourceStorage {
+public:
+    /**
+     * @brief Stores a resource, replacing the previous instance of its type.
+     * @return The stored resource.
+     */
+    template <class Resource, class... Args>
+    Resource& insert(Args&&... args)
+    {
+        std::size_t id = typeId<Resource>();
+        if (id >= _slots.size())
+            _slots.resize(id + 1);
+        if (!_slots[id])
+            _slots[id] = std::make_unique<ResourceSlot<Resource>>();
+        std::optional<Resource>& value = slot<Resource>(id).value;
+        value.reset();
+        return value.emplace(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns a resource, or nullptr if none of this type was inserted.
+     */
+    template <class Resource>
+    Resource* tryGet()
+    {
+        std::size_t id = typeId<Resource>();
+        if (id >= _slots.size() || !_slots[id])
+            return nullptr;
+        std::optional<Resource>& value = slot<Resource>(id).value;
+        return value ? &*value : nullptr;
+    }
+
+    /**
+     * @brief Returns a resource.
+     * @throws ErrorType::EcsComponentAccessError if none of this type was inserted.
+     */
+    template <class Resource>
+    Resource& get()
+    {
+        Resource* resource = tryGet<Resource>();
+        if (!resource)
+            throw Error(ErrorType::EcsComponentAccessError, ErrorMessages::ECS_RESOURCE_NOT_FOUND);
+        return *resource;
+    }
+
+    /**
+     * @brief Tells whether a resource of this type is stored.
+     */
+    template <class Resource>
+    bool has()
+    {
+        return tryGet<Resource>() != nullptr;
+    }
+
+    /**
+     * @brief Destroys the resource of this type, if any.
+     */
+    template <class Resource>
+    void remove()
+    {
+        std::size_t id = typeId<Resource>();
+        if (id < _slots.size() && _slots[id])
+            slot<Resource>(id).value.reset();
+    }
+
+    /**
+     * @brief Saves every resource type ever inserted into one slot of the snapshot ring.
+     */
+    void save(std::size_t slot)
+    {
+        for (const std::unique_ptr<IResourceSlot>& entry : _slots) {
+            if (entry)
+                entry->save(slot);
+        }
+    }
+
+    /**
+     * @brief Puts every resource back as it was when the slot was saved.
+     */
+    void restore(std::size_t slot)
+    {
+        for (const std::unique_ptr<IResourceSlot>& entry : _slots) {
+            if (entry)
+                entry->restore(slot);
+        }
+    }
+
+private:
+    inline static std::size_t _typeCounter = 0;
+
+    /**
+     * @brief Returns the dense ID of a resource type, assigned on first use.
+     */
+    template <class Resource>
+    static std::size_t typeId()
+    {
+        static const std::size_t id = _typeCounter++;
+        return id;
+    }
+
+    template <class Resource>
+    ResourceSlot<Resource>& slot(std::size_t id)
+    {
+        return *static_cast<ResourceSlot<Resource>*>(_slots[id].get());
+    }
+
+    std::vector<std::unique_ptr<IResourceSlot>> _slots;    /**< Resource slots indexed by resource type ID */
+};
+
+#endif /* !RESOURCESTORAGE_HPP_ */
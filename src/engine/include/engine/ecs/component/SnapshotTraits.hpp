@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** SnapshotTraits
+*/
+
+#ifndef SNAPSHOTTRAITS_HPP_
+#define SNAPSHOTTRAITS_HPP_
+
+#include <optional>
+#include <type_traits>
+
+/**
+ * @struct SnapshotTraits
+ * @brief Tells ComponentManager how to copy a component into and out of a world snapshot.
+ *
+ * Pools whose slots are trivially copyable (Transform, Velocity, Health...)
+ * are saved and restored with one memcpy. The others (Level, MovementPattern,
+ * ButtonComponent...) are copied slot by slot through copy(), which reuses
+ * the memory already held by the destination slot where the component's
+ * copy assignment does (std::string, std::vector).
+ *
+ * Specialize it to change how a component is captured, e.g. to skip an
+ * expensive member that rollback never needs:
+ * @code
+ * template <>
+ * struct SnapshotTraits<ButtonComponent> : DefaultSnapshotTraits<ButtonComponent> {
+ *     static void copy(const ButtonComponent& from, std::optional<ButtonComponent>& to) { ... }
+ * };
+ * @endcode
+ *
+ * @tparam Component The type of component stored.
+ */
+template <class Component>
+struct DefaultSnapshotTraits {
+    /** @brief True if the packed slots can be copied as raw bytes */
+    static constexpr bool BITWISE = std::is_trivially_copyable_v<std::optional<Component>>;
+
+    /**
+     * @brief Copies one live component into a snapshot slot (or back).
+     * @param from The component to copy.
+     * @param to The destination slot, possibly holding an older value.
+     */
+    static void copy(const Component& from, std::optional<Component>& to)
+    {
+        if constexpr (std::is_copy_assignable_v<Component>) {
+            to = from;
+        } else {
+            to.reset();
+            to.emplace(from);
+        }
+    }
+};
+
+template <class Component>
+struct SnapshotTraits : DefaultSnapshotTraits<Component> {};
+
+#endif /* !SNAPSHOTTRAITS_HPP_ */
@@ -0,0 +1,147 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** View
+*/
+
+#ifndef VIEW_HPP_
+#define VIEW_HPP_
+
+#include <engine/ecs/component/ArchetypeStorage.hpp>
+#include <engine/ecs/component/ComponentManager.hpp>
+#include <engine/ecs/system/EntitySet.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+/**
+ * @class View
+ * @brief Iterates the entities owning every component of a set, with direct references.
+ *
+ * A view is obtained from EntityManager::view() (or GameEngine::view()).
+ * When a SystemManager is linked, the view walks a cached match list kept up
+ * to date on every signature change (the list of a system with the same
+ * signature is reused), so no per-entity filtering is done at all.
+ * Without one, it walks the smallest participating pool and looks the
+ * entity up in the others. With archetype storage, it walks the columns of
+ * every matching archetype chunk by chunk.
+ *
+ * The ECS structure must not change during each(): record the changes in a
+ * CommandBuffer instead.
+ *
+ * @tparam Components The component types required.
+ */
+template <class... Components>
+class View {
+    static_assert(sizeof...(Components) > 0, "A view needs at least one component");
+
+public:
+    /**
+     * @brief Builds a view over the given pools.
+     * @param matches Cached match list, or nullptr to filter the smallest pool.
+     * @param pools Storage of each component type.
+     */
+    explicit View(const EntitySet* matches, ComponentManager<Components>&... pools)
+        : _matches(matches), _pools(&pools...) {}
+
+    /**
+     * @brief Builds a view over an archetype storage.
+     * @param archetypes Storage holding the components.
+     * @param types Component type ID of each of Components.
+     */
+    View(const ArchetypeStorage& archetypes, const std::array<std::size_t, sizeof...(Components)>& types)
+        : _archetypes(&archetypes), _types(types) {}
+
+    /**
+     * @brief Calls fn(entityId, Components&...) for every matching entity.
+     * @param fn Callable taking (std::size_t, Components&...).
+     */
+    template <class Fn>
+    void each(Fn&& fn) const
+    {
+        if (_archetypes) {
+            _archetypes->each<Components...>(_types, fn);
+            return;
+        }
+        if (_matches) {
+            for (std::size_t e : *_matches)
+                std::apply([&](auto*... pools) { fn(e, pools->get(e)...); }, _pools);
+            return;
+        }
+        eachFromSmallest(fn, std::index_sequence_for<Components...>{});
+    }
+
+    /**
+     * @brief Returns the number of matching entities (an upper bound without a match list).
+     */
+    std::size_t size() const
+    {
+        if (_archetypes)
+            return _archetypes->count(_types);
+        if (_matches)
+            return _matches->size();
+        return std::apply([](auto*... pools) {
+            std::size_t smallest = static_cast<std::size_t>(-1);
+            ((smallest = std::min<std::size_t>(smallest, pools->packedSize())), ...);
+            return smallest;
+        }, _pools);
+    }
+
+private:
+    /**
+     * @brief Dispatches the walk on the pool holding the fewest components.
+     */
+    template <class Fn, std::size_t... I>
+    void eachFromSmallest(Fn& fn, std::index_sequence<I...>) const
+    {
+        const std::size_t sizes[] = {std::get<I>(_pools)->packedSize()...};
+        std::size_t driver = 0;
+        for (std::size_t i = 1; i < sizeof...(I); ++i) {
+            if (sizes[i] < sizes[driver])
+                driver = i;
+        }
+        ((driver == I ? drive<I>(fn, std::index_sequence<I...>{}) : void()), ...);
+    }
+
+    /**
+     * @brief Walks pool D in packed order and looks the entity up in the other pools.
+     */
+    template <std::size_t D, class Fn, std::size_t... I>
+    void drive(Fn& fn, std::index_sequence<I...>) const
+    {
+        auto& pool = *std::get<D>(_pools);
+        const auto& entities = pool.packedEntities();
+
+        for (std::size_t pos = 0; pos < entities.size(); ++pos) {
+            std::size_t e = entities[pos];
+            std::tuple<Components*...> found{fetch<I, D>(e, pos)...};
+            if (((std::get<I>(found) == nullptr) || ...))
+                continue;
+            fn(e, *std::get<I>(found)...);
+        }
+    }
+
+    /**
+     * @brief Component I of an entity: read by packed position for the driving pool, looked up otherwise.
+     */
+    template <std::size_t I, std::size_t D>
+    auto* fetch(std::size_t entity, std::size_t pos) const
+    {
+        if constexpr (I == D)
+            return &std::get<I>(_pools)->packedAt(pos);
+        else
+            return std::get<I>(_pools)->tryGet(entity);
+    }
+
+private:
+    const EntitySet* _matches = nullptr;                     /**< Cached match list (nullable) */
+    std::tuple<ComponentManager<Components>*...> _pools{};   /**< Participating pools (sparse storage) */
+    const ArchetypeStorage* _archetypes = nullptr;           /**< Archetype storage (nullable) */
+    std::array<std::size_t, sizeof...(Components)> _types{}; /**< Component type IDs (archetype storage) */
+};
+
+#endif /* !VIEW_HPP_ */
@@ -0,0 +1,170 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** CommandBuffer
+*/
+
+#ifndef COMMANDBUFFER_HPP_
+#define COMMANDBUFFER_HPP_
+
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/entity/Entity.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class CommandBuffer
+ * @brief Records structural changes (kill, add, remove) and applies them later.
+ *
+ * Systems must not change the ECS structure while they iterate over their
+ * entities: a removal re-matches the entity against every system and may
+ * shrink the set being walked. Instead they record commands here, and the
+ * SystemManager flushes the buffer at its sync points (after each system).
+ *
+ * A flush applies the commands in recording order while signature updates
+ * are held, so each touched entity is re-matched against systems only once.
+ * Commands targeting an entity killed earlier in the same flush are dropped.
+ *
+ * Recording is thread-safe, so systems running in parallel can share the
+ * buffer. Each command is tagged with the rank of the recording system, and
+ * flush() applies them in system order, as a sequential run would.
+ */
+class CommandBuffer {
+public:
+    /**
+     * @brief Creates a buffer applying its commands to an EntityManager.
+     */
+    explicit CommandBuffer(EntityManager& entityManager) : _entityManager(entityManager) {}
+
+    /**
+     * @brief Spawns an entity.
+     *
+     * The ID is allocated immediately so later commands can target it; the
+     * entity has no component yet, so it only joins systems once its
+     * recorded components are added by flush().
+     * @param name The name of the entity.
+     * @param category The category of the entity (LOCAL or NETWORKED).
+     * @return The spawned entity.
+     */
+    Entity spawn(EntityName name, EntityCategory category = EntityCategory::LOCAL)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _entityManager.spawnEntity(name, category);
+    }
+
+    /**
+     * @brief Records the destruction of an entity.
+     */
+    void kill(Entity const& entity)
+    {
+        record([entity](EntityManager& em) {
+            em.killEntity(entity);
+        });
+    }
+
+    /**
+     * @brief Records the addition of a component to an entity.
+     * @tparam Component The type of the component.
+     */
+    template <class Component>
+    void add(Entity const& entity, Component component)
+    {
+        record([entity, component = std::move(component)](EntityManager& em) mutable {
+            if (em.isAlive(entity))
+                em.addComponent<Component>(entity, std::move(component));
+        });
+    }
+
+    /**
+     * @brief Records the removal of components from an entity, as one command.
+     * @tparam Components The types of the components; missing ones are skipped.
+     */
+    template <class... Components>
+    void remove(Entity const& entity)
+    {
+        static_assert(sizeof...(Components) > 0, "remove() needs at least one component");
+        record([entity](EntityManager& em) {
+            if (!em.isAlive(entity))
+                return;
+            ((em.hasComponent<Components>(entity) ? em.removeComponent<Components>(entity) : void()), ...);
+        });
+    }
+
+    /**
+     * @brief Applies every recorded command, then re-matches each touched entity once.
+     */
+    void flush()
+    {
+        std::vector<Command> commands;
+        bool mixedRanks;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            commands.swap(_commands);
+            mixedRanks = _mixedRanks;
+            _mixedRanks = false;
+        }
+        if (commands.empty())
+            return;
+
+        if (mixedRanks) {
+            std::stable_sort(commands.begin(), commands.end(), [](const Command& a, const Command& b) {
+                return a.rank < b.rank;
+            });
+        }
+
+        _entityManager.holdSignatureUpdates();
+        try {
+            for (auto& command : commands)
+                command.apply(_entityManager);
+        } catch (...) {
+            _entityManager.releaseSignatureUpdates();
+            throw;
+        }
+        _entityManager.releaseSignatureUpdates();
+    }
+
+    /** @return Number of recorded commands waiting for flush() */
+    std::size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _commands.size();
+    }
+
+    /** @return True if no command is waiting */
+    bool empty() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _commands.empty();
+    }
+
+private:
+    /**
+     * @brief A recorded command and the rank of the system that recorded it.
+     */
+    struct Command {
+        std::size_t rank;
+        std::function<void(EntityManager&)> apply;
+    };
+
+    void record(std::function<void(EntityManager&)> apply)
+    {
+        std::size_t rank = SystemManager::runningSystemRank();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_commands.empty() && _commands.back().rank != rank)
+            _mixedRanks = true;
+        _commands.push_back({rank, std::move(apply)});
+    }
+
+    EntityManager& _entityManager;          /**< Target of the recorded commands */
+    std::vector<Command> _commands;         /**< Commands in recording order */
+    bool _mixedRanks = false;               /**< Commands come from several systems */
+    mutable std::mutex _mutex;              /**< Guards recording against parallel systems */
+};
+
+#endif /* !COMMANDBUFFER_HPP_ */
@@ -9,15 +9,38 @@
 #define ENTITY_HPP_
 
 #include <iostream>
+#include <cstdint>
+#include <limits>
 
 class EntityManager;
 
+/**
+ * @class Entity
+ * @brief Handle on an entity: its ID plus the generation of that ID.
+ *
+ * The generation is bumped each time the ID is freed, so a handle kept
+ * after its entity was killed no longer passes EntityManager::isAlive(),
+ * even once the ID is recycled. Handles rebuilt from a bare ID with
+ * fromId() match any generation.
+ */
 class Entity {
     public:
+        static constexpr std::uint32_t ANY_GENERATION = std::numeric_limits<std::uint32_t>::max(); /**< Matches every generation */
+
         operator std::size_t() const {
             return this->_id;
         }
 
+        /** @return The entity ID */
+        std::size_t getId() const {
+            return this->_id;
+        }
+
+        /** @return The generation of the ID this handle refers to */
+        std::uint32_t getGeneration() const {
+            return this->_generation;
+        }
+
         static Entity fromId(std::size_t id)
         {
             return Entity(id);
@@ -25,10 +48,11 @@ class Entity {
 
     private:
         std::size_t _id;
+        std::uint32_t _generation;
 
-        explicit Entity(std::size_t id) : _id(id) {}
+        explicit Entity(std::size_t id, std::uint32_t generation = ANY_GENERATION) : _id(id), _generation(generation) {}
 
         friend class EntityManager;
 };
 
-#endif /* !ENTITY_HPP_ */
\ No newline at end of file
+#endif /* !ENTITY_HPP_ */
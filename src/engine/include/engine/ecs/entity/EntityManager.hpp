@@ -8,23 +8,50 @@
 #ifndef ENTITYMANAGER_HPP_
 #define ENTITYMANAGER_HPP_
 
+#include <engine/ecs/component/ArchetypeStorage.hpp>
 #include <engine/ecs/component/ComponentManager.hpp>
+#include <engine/ecs/component/ComponentPool.hpp>
+#include <engine/ecs/component/ResourceStorage.hpp>
+#include <engine/ecs/component/View.hpp>
 #include <engine/ecs/system/SystemManager.hpp>
 #include <engine/ecs/entity/Entity.hpp>
+#include <engine/ecs/entity/EntityName.hpp>
 #include <engine/ecs/Signature.hpp>
 #include <engine/ecs/component/Components.hpp>
 #include <common/logger/Logger.hpp>
 
 #include <common/error/Error.hpp>
 
-#include <unordered_map>
+#include <algorithm>
 #include <vector>
-#include <typeindex>
-#include <functional>
-#include <any>
-#include <unordered_set>
+#include <memory>
 #include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <array>
 #include <cstdint>
+#include <functional>
+#include <utility>
+
+/**
+ * @enum StorageMode
+ * @brief Selects how an EntityManager stores components.
+ */
+enum class StorageMode : uint8_t {
+    SPARSE_SET = 0,     /**< One sparse-set ComponentManager per component type */
+    ARCHETYPE = 1       /**< Entities grouped by signature in SoA chunks (ArchetypeStorage) */
+};
+
+/**
+ * @brief Storage mode of EntityManagers built without an explicit mode.
+ * Set the RTYPE_ECS_ARCHETYPE_STORAGE CMake option to default to archetypes.
+ */
+#ifdef RTYPE_ECS_ARCHETYPE_STORAGE
+static constexpr StorageMode DEFAULT_STORAGE_MODE = StorageMode::ARCHETYPE;
+#else
+static constexpr StorageMode DEFAULT_STORAGE_MODE = StorageMode::SPARSE_SET;
+#endif
 
 /**
  * @enum EntityCategory
@@ -35,6 +62,17 @@ enum class EntityCategory : uint8_t {
     NETWORKED = 1   /**< Networked entity (synchronized over network) */
 };
 
+/**
+ * @enum ComponentEvent
+ * @brief Structural events an observer can listen to (see EntityManager::onAdd()).
+ */
+enum class ComponentEvent : uint8_t {
+    ADD = 0,        /**< The entity gained the component */
+    SET = 1,        /**< An existing component was overwritten or marked dirty */
+    REMOVE = 2,     /**< The component is about to be erased (removal or entity death) */
+    COUNT = 3       /**< Number of events */
+};
+
 /**
  * @brief Offset for networked entity IDs to avoid collisions with local IDs.
  * Local entities use IDs 1 to NETWORKED_ID_OFFSET-1.
@@ -42,6 +80,22 @@ enum class EntityCategory : uint8_t {
  */
 static constexpr size_t NETWORKED_ID_OFFSET = 10000;
 
+/**
+ * @struct SnapshotHandle
+ * @brief Identifies a world snapshot taken by EntityManager::saveState().
+ *
+ * A handle expires once its ring slot is reused by a later save.
+ */
+struct SnapshotHandle {
+    std::size_t slot = 0;           /**< Ring slot holding the snapshot */
+    std::uint64_t sequence = 0;     /**< Save counter value, 0 for a handle that never referred to a snapshot */
+};
+
+/**
+ * @brief Number of snapshots kept by an EntityManager before the oldest is overwritten.
+ */
+static constexpr std::size_t DEFAULT_SNAPSHOT_SLOTS = 8;
+
 /**
  * @class EntityManager
  * @brief Manages entity creation, destruction, signatures, and components.
@@ -54,6 +108,11 @@ static constexpr size_t NETWORKED_ID_OFFSET = 10000;
  *  - manage separate ID spaces for local and networked entities.
  *
  * Does not store any system logic.
+ *
+ * Components live either in one ComponentManager per type (SPARSE_SET) or in
+ * an ArchetypeStorage (ARCHETYPE). The pools returned by getComponents() and
+ * getComponent() only exist in sparse-set mode; tryGetComponent(), view()
+ * and the add/remove/has operations work in both.
  * 
  * Entity ID space is divided:
  *  - Local entities:    1 to NETWORKED_ID_OFFSET-1
@@ -62,39 +121,199 @@ static constexpr size_t NETWORKED_ID_OFFSET = 10000;
 class EntityManager {
 
 private:
-    /**
-     * @brief Removes a component from an entity (generic helper).
-     */
-    template<class Component>
-    static void eraseComponentHelper(EntityManager& em, Entity const& e) {
-        std::type_index key(typeid(Component));
-        auto it = em._componentsArrays.find(key);
-        if (it != em._componentsArrays.end()) {
-            auto& components = std::any_cast<ComponentManager<Component>&>(it->second);
-            if (components.size())
-                components.erase(e);
-        }
-    }
-
     inline static std::size_t _componentTypeCounter = 0;
 
     /**
      * @brief Returns the unique component type ID.
+     *
+     * IDs are dense (0, 1, 2...) and assigned on first use; the same ID is
+     * the Signature bit and the index of the type in the component registry.
      */
     template <class Component>
     static std::size_t getComponentTypeID() {
-        static std::size_t typeId = _componentTypeCounter++;
+        static const std::size_t typeId = _componentTypeCounter++;
         return typeId;
     }
 
+    /**
+     * @brief Returns the registry entry of a component type, or nullptr if not registered.
+     */
+    template <class Component>
+    ComponentPool<Component>* findPool() const {
+        std::size_t id = getComponentTypeID<Component>();
+        if (id >= _componentPools.size() || !_componentPools[id])
+            return nullptr;
+        return static_cast<ComponentPool<Component>*>(_componentPools[id].get());
+    }
+
+    /**
+     * @brief Grows the signature table, and the SystemManager match cache with it.
+     *
+     * Keeping both in step means views built from a PARALLEL batch never
+     * grow the match cache themselves.
+     */
+    void growSignatures(std::size_t size) {
+        if (size <= _signatures.size())
+            return;
+        _signatures.resize(size);
+        if (_systemManager)
+            _systemManager->reserveEntities(size);
+    }
+
+    /**
+     * @brief Forwards an entity's current signature to the SystemManager.
+     *
+     * Only the systems depending on one of the changed components are
+     * re-tested. While updates are held, the entity is only queued (its
+     * changed bits accumulate) and will be re-matched once by
+     * releaseSignatureUpdates().
+     * @param changed Components added or removed by the change.
+     */
+    void notifySignatureChanged(std::size_t id, const Signature& changed) {
+        if (!_systemManager)
+            return;
+        if (_heldSignatureUpdates > 0) {
+            if (id >= _pendingSignatureFlags.size()) {
+                _pendingSignatureFlags.resize(id + 1, false);
+                _pendingChanges.resize(id + 1);
+            }
+            _pendingChanges[id] |= changed;
+            if (!_pendingSignatureFlags[id]) {
+                _pendingSignatureFlags[id] = true;
+                _pendingSignatures.push_back(id);
+            }
+            return;
+        }
+        _systemManager->entitySignatureChanged(id, id < _signatures.size() ? _signatures[id] : Signature(), changed);
+    }
+
+    /**
+     * @brief Returns a signature with only the bit of one component type set.
+     */
+    static Signature componentBit(std::size_t componentId) {
+        Signature bit;
+        bit.set(componentId);
+        return bit;
+    }
+
+    /**
+     * @brief Runs the observers of a component type for one event.
+     */
+    void notifyObservers(ComponentEvent event, std::size_t componentId, std::size_t id) {
+        if (!_observedEvents[static_cast<std::size_t>(event)].test(componentId))
+            return;
+        Entity entity(id, _generations[id]);
+        for (const Observer& observer : _observers[componentId][static_cast<std::size_t>(event)])
+            observer(*this, entity);
+    }
+
+    /**
+     * @brief Registers an observer of a component type, typed as fn(Entity, Component&).
+     */
+    template <class Component, class Fn>
+    void observe(ComponentEvent event, Fn&& fn) {
+        std::size_t componentId = getComponentTypeID<Component>();
+        if (componentId >= _observers.size())
+            _observers.resize(componentId + 1);
+        _observers[componentId][static_cast<std::size_t>(event)].emplace_back(
+            [fn = std::forward<Fn>(fn)](EntityManager& em, Entity entity) {
+                if (Component* component = em.tryGetComponent<Component>(entity))
+                    fn(entity, *component);
+            });
+        _observedEvents[static_cast<std::size_t>(event)].set(componentId);
+    }
+
+    /**
+     * @brief Returns the packed entity list of the smallest of the given pools.
+     */
+    template <class First, class... Others>
+    const std::vector<std::size_t>& smallestPoolEntities() {
+        const std::vector<std::size_t>* smallest = &getComponents<First>().packedEntities();
+        ([&]() {
+            const std::vector<std::size_t>& entities = getComponents<Others>().packedEntities();
+            if (entities.size() < smallest->size())
+                smallest = &entities;
+        }(), ...);
+        return *smallest;
+    }
+
+    /**
+     * @brief Tests the alive bit of an ID.
+     */
+    bool isAliveId(std::size_t id) const {
+        return (id >> 6) < _aliveBits.size() && (_aliveBits[id >> 6] >> (id & 63)) & 1u;
+    }
+
+    /**
+     * @brief Stores the name of an ID; nothing at all when names are compiled out.
+     */
+    void setEntityName(std::size_t id, EntityName name) {
+        if constexpr (EntityName::ENABLED) {
+            if (id >= _entitiesName.size())
+                _entitiesName.resize(id + 1);
+            _entitiesName[id] = name;
+        }
+    }
+
+    /**
+     * @brief Marks an ID alive and appends it to the dense list of its category.
+     * @return The handle of the new entity, carrying the current generation of the ID.
+     */
+    Entity markAlive(std::size_t id, EntityCategory category) {
+        if ((id >> 6) >= _aliveBits.size())
+            _aliveBits.resize((id >> 6) + 1, 0);
+        _aliveBits[id >> 6] |= std::uint64_t(1) << (id & 63);
+        if (id >= _generations.size()) {
+            _generations.resize(id + 1, 0);
+            _densePositions.resize(id + 1, 0);
+        }
+
+        std::vector<std::size_t>& dense = category == EntityCategory::LOCAL ? _localEntities : _networkedEntities;
+        _densePositions[id] = dense.size();
+        dense.push_back(id);
+        return Entity(id, _generations[id]);
+    }
+
+    /**
+     * @brief Clears the alive bit of an ID, swap-removes it from its dense list and bumps its generation.
+     * @return The category the ID belonged to.
+     */
+    EntityCategory markDead(std::size_t id) {
+        _aliveBits[id >> 6] &= ~(std::uint64_t(1) << (id & 63));
+
+        std::size_t pos = _densePositions[id];
+        bool local = pos < _localEntities.size() && _localEntities[pos] == id;
+        std::vector<std::size_t>& dense = local ? _localEntities : _networkedEntities;
+        std::size_t last = dense.back();
+        dense[pos] = last;
+        _densePositions[last] = pos;
+        dense.pop_back();
+
+        if (++_generations[id] == Entity::ANY_GENERATION)
+            _generations[id] = 0;
+        return local ? EntityCategory::LOCAL : EntityCategory::NETWORKED;
+    }
+
 public:
     EntityManager() = default;
 
+    /**
+     * @brief Creates an EntityManager using the given component storage.
+     */
+    explicit EntityManager(StorageMode mode) : _storageMode(mode) {}
+
+    /**
+     * @brief Returns how this EntityManager stores components.
+     */
+    StorageMode getStorageMode() const {
+        return _storageMode;
+    }
+
     /**
      * @brief Returns the unique component type ID for the given component.
      */
     template <class Component>
-    std::size_t getComponentTypeId() const {
+    static std::size_t getComponentTypeId() {
         return getComponentTypeID<Component>();
     }
 
@@ -103,19 +322,21 @@ public:
      */
     void setSystemManager(SystemManager* sm) {
         _systemManager = sm;
+        if (_systemManager)
+            _systemManager->reserveEntities(_signatures.size());
     }
 
     /**
-     * @brief Get all local entities.
+     * @brief Get all local entities, as a dense list in no particular order.
      */
-    const std::unordered_set<std::size_t>& getLocalEntities() const {
+    const std::vector<std::size_t>& getLocalEntities() const {
         return _localEntities;
     }
 
     /**
-     * @brief Get all networked entities.
+     * @brief Get all networked entities, as a dense list in no particular order.
      */
-    const std::unordered_set<std::size_t>& getNetworkedEntities() const {
+    const std::vector<std::size_t>& getNetworkedEntities() const {
         return _networkedEntities;
     }
 
@@ -142,45 +363,67 @@ public:
 
     /**
      * @brief Registers a component type in the ECS.
+     *
+     * The returned pool stays empty in archetype mode.
      */
     template<class Component>
     ComponentManager<Component>& registerComponent() {
-        std::type_index key(typeid(Component));
+        std::size_t id = getComponentTypeID<Component>();
 
-        auto [it, inserted] = _componentsArrays.try_emplace(
-            key,
-            std::any(ComponentManager<Component>{})
-        );
+        if (_storageMode == StorageMode::ARCHETYPE)
+            _archetypes.registerType<Component>(id);
 
-        if (inserted)
-            _erasers[key] = &eraseComponentHelper<Component>;
+        if (id >= _componentPools.size())
+            _componentPools.resize(id + 1);
+        if (!_componentPools[id]) {
+            auto pool = std::make_unique<ComponentPool<Component>>();
+            pool->components.setChangeClock(_changeTick);
+            _componentPools[id] = std::move(pool);
+        }
 
-        return std::any_cast<ComponentManager<Component>&>(it->second);
+        return static_cast<ComponentPool<Component>&>(*_componentPools[id]).components;
     }
 
     /**
      * @brief Retrieves the ComponentManager associated with a component type.
+     * @throws ErrorType::EcsComponentAccessError if the type is not registered or in archetype mode.
      */
     template <class Component>
     ComponentManager<Component>& getComponents() {
-        auto key = std::type_index(typeid(Component));
-
-        auto it = _componentsArrays.find(key);
-        if (it == _componentsArrays.end())
+        ComponentPool<Component>* pool = findPool<Component>();
+        if (!pool || _storageMode == StorageMode::ARCHETYPE)
             throw Error(ErrorType::EcsComponentAccessError, ErrorMessages::ECS_COMPONENT_ACCESS_ERROR);
-
-        return std::any_cast<ComponentManager<Component>&>(it->second);
+        return pool->components;
     }
 
     template <class Component>
     const ComponentManager<Component>& getComponents() const {
-        auto key = std::type_index(typeid(Component));
-
-        auto it = _componentsArrays.find(key);
-        if (it == _componentsArrays.end())
+        const ComponentPool<Component>* pool = findPool<Component>();
+        if (!pool || _storageMode == StorageMode::ARCHETYPE)
             throw Error(ErrorType::EcsComponentAccessError, ErrorMessages::ECS_COMPONENT_ACCESS_ERROR);
+        return pool->components;
+    }
 
-        return std::any_cast<const ComponentManager<Component>&>(it->second);
+    /**
+     * @brief Returns a view over the entities owning all the given components.
+     *
+     * In archetype mode the view walks the matching archetypes. Otherwise,
+     * with a linked SystemManager it walks a cached match list, and without
+     * one it filters the smallest of the pools.
+     * @throws ErrorType::EcsComponentAccessError if a component type is not registered (sparse-set mode).
+     */
+    template <class... Components>
+    View<Components...> view() {
+        if (_storageMode == StorageMode::ARCHETYPE)
+            return View<Components...>(_archetypes, {getComponentTypeID<Components>()...});
+
+        const EntitySet* matches = nullptr;
+        if (_systemManager) {
+            Signature sig;
+            (sig.set(getComponentTypeID<Components>()), ...);
+            matches = &_systemManager->getMatches(sig, smallestPoolEntities<Components...>(), _signatures);
+        }
+        return View<Components...>(matches, getComponents<Components>()...);
     }
 
     /**
@@ -196,16 +439,56 @@ public:
         return getComponents<Component>()[e];
     }
 
+    /**
+     * @brief Returns a pointer to an entity's component, or nullptr when absent (any storage mode).
+     */
+    template<class Component>
+    Component* tryGetComponent(Entity const& e) {
+        if (_storageMode == StorageMode::ARCHETYPE)
+            return _archetypes.tryGet<Component>(e, getComponentTypeID<Component>());
+        return getComponents<Component>().tryGet(e);
+    }
+
+    template<class Component>
+    const Component* tryGetComponent(Entity const& e) const {
+        if (_storageMode == StorageMode::ARCHETYPE)
+            return _archetypes.tryGet<Component>(e, getComponentTypeID<Component>());
+        return getComponents<Component>().tryGet(e);
+    }
+
     /**
      * @brief Updates an entity's signature and notifies SystemManager.
      */
     void setSignature(Entity const &e, Signature signature) {
         std::size_t id = e;
-        if (id >= _signatures.size())
-            _signatures.resize(id + 1);
+        growSignatures(id + 1);
+        Signature changed = _signatures[id] ^ signature;
         _signatures[id] = signature;
-        if (_systemManager)
-            _systemManager->entitySignatureChanged(id, _signatures[id]);
+        notifySignatureChanged(id, changed);
+    }
+
+    /**
+     * @brief Starts coalescing signature changes.
+     *
+     * Until the matching releaseSignatureUpdates(), structural changes only
+     * mark entities as pending, so an entity gaining or losing several
+     * components is re-matched against systems once. Calls may be nested.
+     */
+    void holdSignatureUpdates() {
+        ++_heldSignatureUpdates;
+    }
+
+    /**
+     * @brief Ends a holdSignatureUpdates() scope and re-matches every pending entity once.
+     */
+    void releaseSignatureUpdates() {
+        if (_heldSignatureUpdates == 0 || --_heldSignatureUpdates > 0)
+            return;
+        for (std::size_t id : _pendingSignatures) {
+            _pendingSignatureFlags[id] = false;
+            notifySignatureChanged(id, std::exchange(_pendingChanges[id], Signature()));
+        }
+        _pendingSignatures.clear();
     }
 
     /**
@@ -220,11 +503,11 @@ public:
 
     /**
      * @brief Spawns a new entity and assigns it a name.
-     * @param name The name of the entity
+     * @param name The name of the entity (interned, see EntityName)
      * @param category The category of the entity (LOCAL or NETWORKED)
      * @return The created entity
      */
-    Entity spawnEntity(std::string name, EntityCategory category = EntityCategory::LOCAL) {
+    Entity spawnEntity(EntityName name, EntityCategory category = EntityCategory::LOCAL) {
         size_t id;
         
         if (category == EntityCategory::LOCAL) {
@@ -234,7 +517,6 @@ public:
             } else {
                 id = _nextIdLocal++;
             }
-            _localEntities.insert(id);
         } else {
             if (!_freeIdsNetworked.empty()) {
                 id = _freeIdsNetworked.back();
@@ -242,21 +524,75 @@ public:
             } else {
                 id = NETWORKED_ID_OFFSET + _nextIdNetworked++;
             }
-            _networkedEntities.insert(id);
         }
+        Entity entity = markAlive(id, category);
 
-        if (id >= _signatures.size())
-            _signatures.resize(id + 1);
-        if (id >= _entitiesName.size())
-            _entitiesName.resize(id + 1);
+        growSignatures(id + 1);
 
         _signatures[id].reset();
-        _entitiesName[id] = name;
+        setEntityName(id, name);
 
-        if (_systemManager)
-            _systemManager->entitySignatureChanged(id, _signatures[id]);
+        notifySignatureChanged(id, Signature());
 
-        return Entity(id);
+        return entity;
+    }
+
+    /**
+     * @brief Spawns several entities sharing a name, reserving IDs and storage once.
+     *
+     * Recycled IDs are used first, then fresh consecutive ones. The per-ID
+     * arrays grow once for the whole batch and the entities are re-matched
+     * against systems once, when signature updates are released.
+     * @param count Number of entities to spawn.
+     * @param name The name given to every entity.
+     * @param category The category of the entities (LOCAL or NETWORKED).
+     * @return The created entities, in spawn order.
+     */
+    std::vector<Entity> spawnEntities(std::size_t count, EntityName name, EntityCategory category = EntityCategory::LOCAL) {
+        std::vector<Entity> entities;
+        entities.reserve(count);
+
+        std::vector<std::size_t>& freeIds = category == EntityCategory::LOCAL ? _freeIdsLocal : _freeIdsNetworked;
+        std::size_t recycled = std::min(count, freeIds.size());
+        std::size_t fresh = count - recycled;
+        std::size_t firstFresh = category == EntityCategory::LOCAL ? _nextIdLocal : NETWORKED_ID_OFFSET + _nextIdNetworked;
+        if (category == EntityCategory::LOCAL)
+            _nextIdLocal += fresh;
+        else
+            _nextIdNetworked += fresh;
+
+        std::size_t highest = fresh > 0 ? firstFresh + fresh - 1 : 0;
+        for (std::size_t i = freeIds.size() - recycled; i < freeIds.size(); ++i)
+            highest = std::max(highest, freeIds[i]);
+        growSignatures(highest + 1);
+        if constexpr (EntityName::ENABLED) {
+            if (highest >= _entitiesName.size())
+                _entitiesName.resize(highest + 1);
+        }
+        if (highest >= _generations.size()) {
+            _generations.resize(highest + 1, 0);
+            _densePositions.resize(highest + 1, 0);
+            _aliveBits.resize((highest >> 6) + 1, 0);
+        }
+        std::vector<std::size_t>& dense = category == EntityCategory::LOCAL ? _localEntities : _networkedEntities;
+        if (dense.size() + count > dense.capacity())
+            dense.reserve(std::max(dense.size() + count, dense.capacity() * 2));
+
+        holdSignatureUpdates();
+        auto spawn = [&](std::size_t id) {
+            entities.push_back(markAlive(id, category));
+            _signatures[id].reset();
+            setEntityName(id, name);
+            notifySignatureChanged(id, Signature());
+        };
+        for (std::size_t i = 0; i < recycled; ++i) {
+            spawn(freeIds.back());
+            freeIds.pop_back();
+        }
+        for (std::size_t i = 0; i < fresh; ++i)
+            spawn(firstFresh + i);
+        releaseSignatureUpdates();
+        return entities;
     }
 
     /**
@@ -277,7 +613,7 @@ public:
         // Clean up free list: remove IDs that are still alive (shouldn't happen, but be safe)
         while (!_freeIdsNetworked.empty()) {
             uint32_t candidateId = _freeIdsNetworked.back();
-            if (_networkedEntities.find(candidateId) == _networkedEntities.end()) {
+            if (!isAliveId(candidateId)) {
                 // This ID is truly free, return the network-relative ID
                 _freeIdsNetworked.pop_back();
                 return toNetworkRelativeId(candidateId);
@@ -289,7 +625,7 @@ public:
         // No recyclable IDs available, generate a new one
         // Skip any IDs that are still in use (shouldn't happen normally)
         size_t actualId = NETWORKED_ID_OFFSET + _nextIdNetworked;
-        while (_networkedEntities.find(actualId) != _networkedEntities.end()) {
+        while (isAliveId(actualId)) {
             _nextIdNetworked++;
             actualId = NETWORKED_ID_OFFSET + _nextIdNetworked;
         }
@@ -305,7 +641,7 @@ public:
      * @param category The category of the entity (LOCAL or NETWORKED)
      * @return The created Entity
      */
-    Entity spawnEntityWithId(std::size_t id, std::string name, EntityCategory category = EntityCategory::NETWORKED) {
+    Entity spawnEntityWithId(std::size_t id, EntityName name, EntityCategory category = EntityCategory::NETWORKED) {
         std::size_t actualId = id;
         
         // For networked entities, auto-detect if the ID already has the offset
@@ -315,17 +651,10 @@ public:
             actualId = NETWORKED_ID_OFFSET + id;
         }
 
-        // Check only in the appropriate list (not in both)
-        if (category == EntityCategory::LOCAL) {
-            if (_localEntities.find(actualId) != _localEntities.end()) {
-                LOG_ERROR("Entity with ID {} already exists in LOCAL list, cannot spawn", actualId);
-                throw Error(ErrorType::EcsInvalidEntity, "Entity ID already in use");
-            }
-        } else {
-            if (_networkedEntities.find(actualId) != _networkedEntities.end()) {
-                LOG_ERROR("Entity with ID {} already exists in NETWORKED list, cannot spawn", actualId);
-                throw Error(ErrorType::EcsInvalidEntity, "Entity ID already in use");
-            }
+        // Local and networked entities share the signature and name arrays, so an ID is alive in one category at most
+        if (isAliveId(actualId)) {
+            LOG_ERROR("Entity with ID {} already exists, cannot spawn", actualId);
+            throw Error(ErrorType::EcsInvalidEntity, "Entity ID already in use");
         }
 
         // Get the appropriate free list based on category
@@ -340,90 +669,115 @@ public:
         if (category == EntityCategory::LOCAL) {
             if (actualId >= _nextIdLocal)
                 _nextIdLocal = actualId + 1;
-            _localEntities.insert(actualId);
         } else {
             std::size_t relativeId = actualId - NETWORKED_ID_OFFSET;
             if (relativeId >= _nextIdNetworked)
                 _nextIdNetworked = relativeId + 1;
-            _networkedEntities.insert(actualId);
         }
+        Entity entity = markAlive(actualId, category);
 
         // resize vectors (if necessary)
-        if (actualId >= _signatures.size())
-            _signatures.resize(actualId + 1);
-        if (actualId >= _entitiesName.size())
-            _entitiesName.resize(actualId + 1);
+        growSignatures(actualId + 1);
 
         // init the entity
         _signatures[actualId].reset();
-        _entitiesName[actualId] = name;
+        setEntityName(actualId, name);
 
         // notify the systemManager
-        if (_systemManager)
-            _systemManager->entitySignatureChanged(actualId, _signatures[actualId]);
+        notifySignatureChanged(actualId, Signature());
 
-        return Entity::fromId(actualId);
+        return entity;
     }
 
     /**
      * @brief Get an entity from his id.
      * @param entityId The network-relative ID for networked entities, or direct ID for local entities.
      * @param isNetworked Whether this is a networked entity ID.
+     * @return A handle on the current generation of the ID.
      */
     Entity getEntityFromID(std::uint32_t entityId, bool isNetworked = false)
     {
         std::size_t actualId = isNetworked ? (NETWORKED_ID_OFFSET + entityId) : entityId;
-        Entity entity = Entity::fromId(actualId);
-        return entity;
+        return getEntityFromDirectID(actualId);
     }
 
     /**
      * @brief Get an entity from his id (direct ID, no conversion).
+     * @return A handle on the current generation of the ID.
      */
     Entity getEntityFromDirectID(std::size_t entityId)
     {
-        return Entity::fromId(entityId);
+        return Entity(entityId, entityId < _generations.size() ? _generations[entityId] : 0);
     }
 
     /**
      * @brief Destroys an entity and removes all its components.
+     *
+     * Does nothing if the entity is dead, or if the handle is stale (its ID
+     * was recycled for another entity since).
      */
     void killEntity(Entity const &entity) {
         std::size_t id = entity;
-        
-        // Find which list it's in
-        bool isLocal = _localEntities.find(id) != _localEntities.end();
-        bool isNetworked = _networkedEntities.find(id) != _networkedEntities.end();
 
-        if (!isLocal && !isNetworked)
+        if (!isAlive(entity))
             return;
 
-        // Remove from appropriate list
-        if (isLocal) {
-            _localEntities.erase(id);
+        // Observers still see a live entity with all its components
+        Signature owned = id < _signatures.size() ? _signatures[id] : Signature();
+        Signature observed = owned & _observedEvents[static_cast<std::size_t>(ComponentEvent::REMOVE)];
+        for (std::size_t type = 0; observed.any() && type < MAX_COMPONENTS; ++type) {
+            if (observed.test(type)) {
+                notifyObservers(ComponentEvent::REMOVE, type, id);
+                observed.reset(type);
+            }
+        }
+
+        if (markDead(id) == EntityCategory::LOCAL)
             _freeIdsLocal.push_back(id);
-        } else {
-            _networkedEntities.erase(id);
+        else
             _freeIdsNetworked.push_back(id);
-        }
 
         if (id < _signatures.size())
             _signatures[id].reset();
 
-        if (_systemManager)
-            _systemManager->entitySignatureChanged(id, Signature());
+        notifySignatureChanged(id, owned);
+
+        if (_storageMode == StorageMode::ARCHETYPE) {
+            _archetypes.erase(id);
+            return;
+        }
+
+        // Only the pools flagged in the signature can hold a component of this entity
+        for (std::size_t type = 0; type < _componentPools.size(); ++type) {
+            if (owned.test(type) && _componentPools[type])
+                _componentPools[type]->erase(id);
+        }
+    }
 
-        for (auto& [key, fn] : _erasers)
-            fn(*this, entity);
+    /**
+     * @brief Destroys several entities, re-matching systems once for the whole batch.
+     *
+     * Dead entities and stale handles are skipped, like killEntity().
+     */
+    void killEntities(std::span<const Entity> entities) {
+        holdSignatureUpdates();
+        for (const Entity& entity : entities)
+            killEntity(entity);
+        releaseSignatureUpdates();
     }
 
     /**
      * @brief Checks whether an entity is alive.
+     *
+     * A handle returned before its entity was killed stays dead even once
+     * the ID is recycled; a handle built with Entity::fromId() matches any
+     * generation.
      */
     bool isAlive(Entity const& e) const {
         std::size_t id = e;
-        return _localEntities.find(id) != _localEntities.end() || 
-               _networkedEntities.find(id) != _networkedEntities.end();
+        if (!isAliveId(id))
+            return false;
+        return e._generation == Entity::ANY_GENERATION || e._generation == _generations[id];
     }
 
     /**
@@ -431,26 +785,26 @@ public:
      */
     template <class Component>
     bool hasComponent(Entity const& e) const {
-        auto& components = getComponents<Component>();
-        std::size_t id = e;
-        return id < components.size() && components[id].has_value();
+        if (_storageMode == StorageMode::ARCHETYPE)
+            return _archetypes.contains(e, getComponentTypeID<Component>());
+        return getComponents<Component>().contains(e);
     }
 
     /**
-     * @brief Retrieves the name assigned to an entity.
+     * @brief Retrieves the name assigned to an entity ("" when names are compiled out).
      */
-    std::string getEntityName(Entity const& e) const {
+    std::string_view getEntityName(Entity const& e) const {
         std::size_t id = e;
         if (id >= _entitiesName.size())
-            return "";
-        return _entitiesName[id];
+            return {};
+        return _entitiesName[id].view();
     }
 
     /**
      * @brief Adds a component to an entity.
      */
     template <class Component>
-    typename ComponentManager<Component>::referenceType addComponent(Entity const &e, Component &&c)
+    Component& addComponent(Entity const &e, Component &&c)
     {
         if (!isAlive(e))
             throw Error(ErrorType::EcsInvalidEntity, ErrorMessages::ECS_INVALID_ENTITY);
@@ -458,38 +812,91 @@ public:
         std::size_t id = e;
         std::size_t componentId = getComponentTypeID<Component>();
         
-        if (id >= _signatures.size())
-            _signatures.resize(id + 1);
+        growSignatures(id + 1);
+        bool existed = _signatures[id].test(componentId);
         _signatures[id].set(componentId, true);
 
         LOG_DEBUG("addComponent: entity={} componentType={} componentId={} signature={}", 
                   id, typeid(Component).name(), componentId, _signatures[id].to_string());
 
-        if (_systemManager)
-            _systemManager->entitySignatureChanged(id, _signatures[id]);
+        if (!existed)
+            notifySignatureChanged(id, componentBit(componentId));
 
-        return getComponents<Component>().insertAt(id, std::forward<Component>(c));
+        Component& component = _storageMode == StorageMode::ARCHETYPE
+            ? _archetypes.insert(id, componentId, std::forward<Component>(c))
+            : *getComponents<Component>().insertAt(id, std::forward<Component>(c));
+        notifyObservers(existed ? ComponentEvent::SET : ComponentEvent::ADD, componentId, id);
+        return component;
     }
 
     /**
      * @brief Constructs a component in-place for an entity.
      */
     template<class Component, class... Params>
-    typename ComponentManager<Component>::referenceType emplaceComponent(Entity const& e, Params&&... ps) {
+    Component& emplaceComponent(Entity const& e, Params&&... ps) {
         if (!isAlive(e))
             throw Error(ErrorType::EcsInvalidEntity, ErrorMessages::ECS_INVALID_ENTITY);
 
         std::size_t id = e;
         std::size_t componentId = getComponentTypeID<Component>();
         
-        if (id >= _signatures.size())
-            _signatures.resize(id + 1);
+        growSignatures(id + 1);
+        bool existed = _signatures[id].test(componentId);
         _signatures[id].set(componentId, true);
 
-        if (_systemManager)
-            _systemManager->entitySignatureChanged(id, _signatures[id]);
+        if (!existed)
+            notifySignatureChanged(id, componentBit(componentId));
+
+        Component& component = _storageMode == StorageMode::ARCHETYPE
+            ? _archetypes.emplace<Component>(id, componentId, std::forward<Params>(ps)...)
+            : *getComponents<Component>().emplaceAt(id, std::forward<Params>(ps)...);
+        notifyObservers(existed ? ComponentEvent::SET : ComponentEvent::ADD, componentId, id);
+        return component;
+    }
+
+    /**
+     * @brief Adds a copy of the same component to several entities.
+     *
+     * The storage grows once for the whole batch and each entity is
+     * re-matched against systems once.
+     * @throws ErrorType::EcsInvalidEntity if one of the entities is dead (nothing is added then).
+     */
+    template <class Component>
+    void addComponents(std::span<const Entity> entities, const Component& value) {
+        std::size_t highest = 0;
+        for (const Entity& e : entities) {
+            if (!isAlive(e))
+                throw Error(ErrorType::EcsInvalidEntity, ErrorMessages::ECS_INVALID_ENTITY);
+            highest = std::max<std::size_t>(highest, e);
+        }
+        if (entities.empty())
+            return;
+
+        std::size_t componentId = getComponentTypeID<Component>();
+        ComponentManager<Component>* pool = nullptr;
+        if (_storageMode == StorageMode::SPARSE_SET) {
+            pool = &getComponents<Component>();
+            pool->ensureSize(highest);
+            // Grow geometrically so that repeated small batches stay amortized O(1) per component
+            if (pool->packedSize() + entities.size() > pool->capacity())
+                pool->reserve(std::max(pool->packedSize() + entities.size(), pool->capacity() * 2));
+        }
 
-        return getComponents<Component>().emplaceAt(id, std::forward<Params>(ps)...);
+        Signature bit = componentBit(componentId);
+        holdSignatureUpdates();
+        for (const Entity& e : entities) {
+            std::size_t id = e;
+            bool existed = _signatures[id].test(componentId);
+            _signatures[id].set(componentId, true);
+            if (!existed)
+                notifySignatureChanged(id, bit);
+            if (pool)
+                pool->insertAt(id, value);
+            else
+                _archetypes.insert(id, componentId, Component(value));
+            notifyObservers(existed ? ComponentEvent::SET : ComponentEvent::ADD, componentId, id);
+        }
+        releaseSignatureUpdates();
     }
 
     template<class Component>
@@ -497,8 +904,87 @@ public:
         if (!isAlive(e))
             throw Error(ErrorType::EcsInvalidEntity, ErrorMessages::ECS_INVALID_ENTITY);
 
-        auto& component = getComponent<Component>(e);
-        component = newData;
+        if (Component* component = tryGetComponent<Component>(e)) {
+            *component = newData;
+            markDirty<Component>(e);
+        }
+    }
+
+    /**
+     * @brief Records a write made through a reference to an entity's component.
+     *
+     * addComponent(), emplaceComponent() and updateComponent() already do it.
+     * Runs the onSet() observers of the component; the change tick is not
+     * tracked in archetype mode.
+     */
+    template<class Component>
+    void markDirty(Entity const& e) {
+        if (_storageMode == StorageMode::SPARSE_SET)
+            getComponents<Component>().markChanged(e);
+        notifyObservers(ComponentEvent::SET, getComponentTypeID<Component>(), e);
+    }
+
+    /**
+     * @brief Returns the tick stamped on component writes made now.
+     */
+    std::uint32_t getChangeTick() const {
+        return *_changeTick;
+    }
+
+    /**
+     * @brief Starts a new change tick; later writes are reported as changed since the current one.
+     * @return The new tick.
+     */
+    std::uint32_t advanceChangeTick() {
+        return ++*_changeTick;
+    }
+
+    /**
+     * @brief Calls fn(entityId, component) for every component of a type written after a tick.
+     * @param tick The last tick the caller has already seen, usually a getChangeTick() value
+     *             followed by advanceChangeTick().
+     * @throws ErrorType::EcsComponentAccessError if the type is not registered or in archetype mode.
+     */
+    template<class Component, class Fn>
+    void forEachChangedSince(std::uint32_t tick, Fn&& fn) {
+        getComponents<Component>().forEachChangedSince(tick, std::forward<Fn>(fn));
+    }
+
+    /**
+     * @brief Calls fn(entity, component) each time an entity gains a component of this type.
+     *
+     * Runs right after the component is stored (addComponent(), emplaceComponent(),
+     * addComponents(), prefabs). Writing to the component is allowed; structural
+     * changes (adding, removing, killing) must be deferred, e.g. through a CommandBuffer.
+     * restoreState() does not run observers.
+     * @tparam Component The observed component type.
+     * @param fn Callable taking (Entity, Component&).
+     */
+    template<class Component, class Fn>
+    void onAdd(Fn&& fn) {
+        observe<Component>(ComponentEvent::ADD, std::forward<Fn>(fn));
+    }
+
+    /**
+     * @brief Calls fn(entity, component) when an existing component is overwritten
+     *        (add on an entity that already has it, updateComponent(), markDirty()).
+     * @tparam Component The observed component type.
+     * @param fn Callable taking (Entity, Component&).
+     */
+    template<class Component, class Fn>
+    void onSet(Fn&& fn) {
+        observe<Component>(ComponentEvent::SET, std::forward<Fn>(fn));
+    }
+
+    /**
+     * @brief Calls fn(entity, component) just before a component is erased,
+     *        by removeComponent() or because its entity is killed.
+     * @tparam Component The observed component type.
+     * @param fn Callable taking (Entity, Component&).
+     */
+    template<class Component, class Fn>
+    void onRemove(Fn&& fn) {
+        observe<Component>(ComponentEvent::REMOVE, std::forward<Fn>(fn));
     }
 
     /**
@@ -511,16 +997,209 @@ public:
 
         std::size_t id = e;
         std::size_t componentId = getComponentTypeID<Component>();
-        
-        if (id < _signatures.size())
+        bool existed = id < _signatures.size() && _signatures[id].test(componentId);
+
+        if (existed) {
+            notifyObservers(ComponentEvent::REMOVE, componentId, id);
             _signatures[id].set(componentId, false);
+            notifySignatureChanged(id, componentBit(componentId));
+        }
 
-        if (_systemManager)
-            _systemManager->entitySignatureChanged(id, id < _signatures.size() ? _signatures[id] : Signature());
+        if (_storageMode == StorageMode::ARCHETYPE)
+            _archetypes.remove(id, componentId);
+        else
+            getComponents<Component>().erase(id);
+    }
+
+
+    /**
+     * @brief Sets the number of snapshots kept before the oldest is overwritten.
+     *
+     * Every saved handle expires. The slots are allocated up front; their
+     * buffers reach their working size during the first lap of the ring,
+     * after which saving and restoring no longer allocate.
+     * @param slots Ring size (at least one slot is kept).
+     */
+    void setSnapshotCapacity(std::size_t slots) {
+        _snapshots.clear();
+        _snapshots.resize(std::max<std::size_t>(slots, 1));
+    }
+
+    /**
+     * @brief Stores a world resource, replacing the previous instance of its type.
+     *
+     * Resources are typed singletons (configuration, score, current level...)
+     * kept outside the entity pools: accessing one does not iterate anything.
+     * They work in both storage modes and are part of world snapshots.
+     * @return The stored resource.
+     */
+    template<class Resource, class... Args>
+    Resource& insertResource(Args&&... args) {
+        return _resources.insert<Resource>(std::forward<Args>(args)...);
+    }
 
-        getComponents<Component>().erase(id);
+    /**
+     * @brief Returns a world resource.
+     * @throws ErrorType::EcsComponentAccessError if no resource of this type was inserted.
+     */
+    template<class Resource>
+    Resource& getResource() {
+        return _resources.get<Resource>();
     }
 
+    /**
+     * @brief Returns a world resource, or nullptr if none of this type was inserted.
+     */
+    template<class Resource>
+    Resource* tryGetResource() {
+        return _resources.tryGet<Resource>();
+    }
+
+    /**
+     * @brief Tells whether a world resource of this type is stored.
+     */
+    template<class Resource>
+    bool hasResource() {
+        return _resources.has<Resource>();
+    }
+
+    /**
+     * @brief Destroys the world resource of this type, if any.
+     */
+    template<class Resource>
+    void removeResource() {
+        _resources.remove<Resource>();
+    }
+
+    /**
+     * @brief Captures every registered component pool, the resources, the signatures and the ID allocators.
+     *
+     * The snapshot goes to the next slot of a ring (see setSnapshotCapacity()),
+     * overwriting the oldest one. Trivially copyable pools are copied with a
+     * memcpy, the others through SnapshotTraits.
+     * @return The handle to pass to restoreState().
+     * @throws ErrorType::EcsError in archetype mode or if a registered component is not copyable.
+     */
+    SnapshotHandle saveState() {
+        if (_storageMode == StorageMode::ARCHETYPE)
+            throw Error(ErrorType::EcsError, ErrorMessages::ECS_SNAPSHOT_UNSUPPORTED);
+        if (_snapshots.empty())
+            _snapshots.resize(DEFAULT_SNAPSHOT_SLOTS);
+
+        SnapshotHandle handle{_snapshotSequence % _snapshots.size(), _snapshotSequence + 1};
+        EntityState& state = _snapshots[handle.slot];
+        state.sequence = 0;
+
+        state.savedPools.reset();
+        for (std::size_t type = 0; type < _componentPools.size() && type < MAX_COMPONENTS; ++type) {
+            if (_componentPools[type]) {
+                _componentPools[type]->save(handle.slot);
+                state.savedPools.set(type);
+            }
+        }
+        _resources.save(handle.slot);
+        state.nextIdLocal = _nextIdLocal;
+        state.nextIdNetworked = _nextIdNetworked;
+        state.freeIdsLocal.assign(_freeIdsLocal.begin(), _freeIdsLocal.end());
+        state.freeIdsNetworked.assign(_freeIdsNetworked.begin(), _freeIdsNetworked.end());
+        state.localEntities.assign(_localEntities.begin(), _localEntities.end());
+        state.networkedEntities.assign(_networkedEntities.begin(), _networkedEntities.end());
+        state.aliveBits.assign(_aliveBits.begin(), _aliveBits.end());
+        state.generations.assign(_generations.begin(), _generations.end());
+        state.densePositions.assign(_densePositions.begin(), _densePositions.end());
+        state.signatures.assign(_signatures.begin(), _signatures.end());
+        // Names of dead IDs are overwritten on spawn, only the live ones are kept (local then networked order)
+        if constexpr (EntityName::ENABLED) {
+            state.entitiesName.resize(_localEntities.size() + _networkedEntities.size());
+            std::size_t named = 0;
+            for (std::size_t id : _localEntities)
+                state.entitiesName[named++] = _entitiesName[id];
+            for (std::size_t id : _networkedEntities)
+                state.entitiesName[named++] = _entitiesName[id];
+        }
+
+        state.sequence = ++_snapshotSequence;
+        return handle;
+    }
+
+    /**
+     * @brief Puts the world back in the state captured by saveState().
+     *
+     * Entities whose signature differs from the snapshot are re-matched
+     * against systems; handles taken after the save become stale if their
+     * entity did not exist then. Pools registered after the save are emptied
+     * and resources inserted after it are removed.
+     * Call it between frames: commands still queued in a CommandBuffer are not
+     * part of the snapshot.
+     * @param handle A handle returned by saveState().
+     * @throws ErrorType::EcsError if the handle expired (its slot was reused) or was never valid.
+     */
+    void restoreState(SnapshotHandle handle) {
+        if (handle.sequence == 0 || handle.slot >= _snapshots.size()
+            || _snapshots[handle.slot].sequence != handle.sequence)
+            throw Error(ErrorType::EcsError, ErrorMessages::ECS_SNAPSHOT_EXPIRED);
+        const EntityState& state = _snapshots[handle.slot];
+
+        // Only the entities whose signature changed since the save need matching again.
+        // Dead IDs have an empty signature, so only the IDs alive now or at save time can differ.
+        _restoredIds.clear();
+        _restoredChanges.clear();
+        auto savedSignature = [&state](std::size_t id) {
+            return id < state.signatures.size() ? state.signatures[id] : Signature();
+        };
+        for (const std::vector<std::size_t>* dense : {&_localEntities, &_networkedEntities}) {
+            for (std::size_t id : *dense) {
+                if (_signatures[id] != savedSignature(id)) {
+                    _restoredIds.push_back(id);
+                    _restoredChanges.push_back(_signatures[id] ^ savedSignature(id));
+                }
+            }
+        }
+        for (const std::vector<std::size_t>* dense : {&state.localEntities, &state.networkedEntities}) {
+            for (std::size_t id : *dense) {
+                if (!isAliveId(id) && savedSignature(id).any()) {
+                    _restoredIds.push_back(id);
+                    _restoredChanges.push_back((id < _signatures.size() ? _signatures[id] : Signature()) ^ savedSignature(id));
+                }
+            }
+        }
+
+        for (std::size_t type = 0; type < _componentPools.size(); ++type) {
+            if (!_componentPools[type])
+                continue;
+            if (type < MAX_COMPONENTS && state.savedPools.test(type))
+                _componentPools[type]->restore(handle.slot);
+            else
+                _componentPools[type]->clear();
+        }
+        _resources.restore(handle.slot);
+        _nextIdLocal = state.nextIdLocal;
+        _nextIdNetworked = state.nextIdNetworked;
+        _freeIdsLocal.assign(state.freeIdsLocal.begin(), state.freeIdsLocal.end());
+        _freeIdsNetworked.assign(state.freeIdsNetworked.begin(), state.freeIdsNetworked.end());
+        _localEntities.assign(state.localEntities.begin(), state.localEntities.end());
+        _networkedEntities.assign(state.networkedEntities.begin(), state.networkedEntities.end());
+        _aliveBits.assign(state.aliveBits.begin(), state.aliveBits.end());
+        _generations.assign(state.generations.begin(), state.generations.end());
+        _densePositions.assign(state.densePositions.begin(), state.densePositions.end());
+        _signatures.assign(state.signatures.begin(), state.signatures.end());
+        if (_systemManager)
+            _systemManager->reserveEntities(_signatures.size());
+        if constexpr (EntityName::ENABLED) {
+            if (_signatures.size() > _entitiesName.size())
+                _entitiesName.resize(_signatures.size());
+            std::size_t named = 0;
+            for (std::size_t id : _localEntities)
+                _entitiesName[id] = state.entitiesName[named++];
+            for (std::size_t id : _networkedEntities)
+                _entitiesName[id] = state.entitiesName[named++];
+        }
+
+        holdSignatureUpdates();
+        for (std::size_t i = 0; i < _restoredIds.size(); ++i)
+            notifySignatureChanged(_restoredIds[i], _restoredChanges[i]);
+        releaseSignatureUpdates();
+    }
 
     void removeComponentByType(uint8_t componentType, Entity entity)
     {
@@ -561,24 +1240,64 @@ public:
         }
     }
 private:
-    std::unordered_map<std::type_index, std::any> _componentsArrays; /**< Storage for all component arrays */
-    std::unordered_map<std::type_index, std::function<void(EntityManager&,Entity const&)>> _erasers; /**< Generic component removers */
+    StorageMode _storageMode = DEFAULT_STORAGE_MODE; /**< Component storage backend */
+    std::vector<std::unique_ptr<IComponentPool>> _componentPools; /**< Component storages indexed by component type ID (sparse-set mode) */
+    ArchetypeStorage _archetypes; /**< Component storage (archetype mode) */
+    ResourceStorage _resources; /**< World resources (typed singletons) */
 
     // Local entity management (IDs: 1 to NETWORKED_ID_OFFSET-1)
     size_t _nextIdLocal = 1;  // Start at 1, 0 is reserved for errors
     std::vector<std::size_t> _freeIdsLocal; /**< Recycled local entity IDs */
-    std::unordered_set<std::size_t> _localEntities; /**< Local entities (not networked) */
+    std::vector<std::size_t> _localEntities; /**< Local entities (not networked), dense */
 
     // Networked entity management (IDs: NETWORKED_ID_OFFSET+)
     size_t _nextIdNetworked = 0;  // Relative ID, actual ID = NETWORKED_ID_OFFSET + _nextIdNetworked
     std::vector<std::size_t> _freeIdsNetworked; /**< Recycled networked entity IDs (actual IDs with offset) */
-    std::unordered_set<std::size_t> _networkedEntities; /**< Networked entities (synchronized) */
+    std::vector<std::size_t> _networkedEntities; /**< Networked entities (synchronized), dense */
 
     // Shared state (single unified space since IDs don't overlap)
+    std::vector<std::uint64_t> _aliveBits; /**< One alive bit per entity ID */
+    std::vector<std::uint32_t> _generations; /**< Current generation per entity ID */
+    std::vector<std::size_t> _densePositions; /**< Position of each alive ID in its dense list */
     std::vector<Signature> _signatures; /**< Signatures per entity */
-    std::vector<std::string> _entitiesName; /**< Names per entity */
+    std::vector<EntityName> _entitiesName; /**< Names per entity, empty when names are compiled out */
+
+    /**
+     * @struct EntityState
+     * @brief Entity bookkeeping captured by saveState(); component pools keep their own ring.
+     */
+    struct EntityState {
+        std::uint64_t sequence = 0; /**< Save counter value of the snapshot, 0 while empty or being written */
+        Signature savedPools; /**< Component types whose pool was saved */
+        std::size_t nextIdLocal = 1;
+        std::size_t nextIdNetworked = 0;
+        std::vector<std::size_t> freeIdsLocal;
+        std::vector<std::size_t> freeIdsNetworked;
+        std::vector<std::size_t> localEntities;
+        std::vector<std::size_t> networkedEntities;
+        std::vector<std::uint64_t> aliveBits;
+        std::vector<std::uint32_t> generations;
+        std::vector<std::size_t> densePositions;
+        std::vector<Signature> signatures;
+        std::vector<EntityName> entitiesName;
+    };
+
+    std::vector<EntityState> _snapshots; /**< Snapshot ring */
+    std::uint64_t _snapshotSequence = 0; /**< Number of snapshots taken */
+    std::vector<std::size_t> _restoredIds; /**< Scratch list of entities re-matched by restoreState() */
+    std::vector<Signature> _restoredChanges; /**< Components that differ from the snapshot, per _restoredIds entry */
+
+    std::shared_ptr<std::uint32_t> _changeTick = std::make_shared<std::uint32_t>(1); /**< Tick stamped on component writes, shared with the pools */
 
     SystemManager* _systemManager = nullptr; /**< Callback target for signature updates */
+    std::size_t _heldSignatureUpdates = 0; /**< Nesting depth of holdSignatureUpdates() */
+    std::vector<std::size_t> _pendingSignatures; /**< Entities to re-match on release, in first-change order */
+    std::vector<bool> _pendingSignatureFlags; /**< Per-entity "already pending" flag */
+    std::vector<Signature> _pendingChanges; /**< Per-entity components changed while updates are held */
+
+    using Observer = std::function<void(EntityManager&, Entity)>;
+    std::vector<std::array<std::vector<Observer>, static_cast<std::size_t>(ComponentEvent::COUNT)>> _observers; /**< Observers per component type ID, then per event */
+    std::array<Signature, static_cast<std::size_t>(ComponentEvent::COUNT)> _observedEvents{}; /**< Component types having observers, per event */
 };
 
 #endif /* !ENTITYMANAGER_HPP_ */
@@ -0,0 +1,138 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** EntityName
+*/
+
+#ifndef ENTITYNAME_HPP_
+#define ENTITYNAME_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @class NameTable
+ * @brief Process-wide table of interned strings.
+ *
+ * Every distinct string is stored once and referred to by a 32-bit ID;
+ * ID 0 is the empty string. Strings are never removed, so the table is
+ * meant for a bounded set of names (entity kinds, prefabs), not for
+ * per-instance strings. Interning and lookups may run on any thread.
+ */
+class NameTable {
+public:
+    static constexpr std::uint32_t EMPTY = 0;   /**< ID of the empty string */
+
+    /**
+     * @brief Returns the ID of a string, adding it to the table the first time.
+     */
+    static std::uint32_t intern(std::string_view name)
+    {
+        if (name.empty())
+            return EMPTY;
+        NameTable& table = instance();
+        {
+            std::shared_lock<std::shared_mutex> lock(table._mutex);
+            auto it = table._ids.find(name);
+            if (it != table._ids.end())
+                return it->second;
+        }
+        std::unique_lock<std::shared_mutex> lock(table._mutex);
+        auto it = table._ids.find(name);
+        if (it != table._ids.end())
+            return it->second;
+        std::uint32_t id = static_cast<std::uint32_t>(table._names.size());
+        // Deque elements never move, so the keys keep pointing at valid characters
+        const std::string& stored = table._names.emplace_back(name);
+        table._ids.emplace(std::string_view(stored), id);
+        return id;
+    }
+
+    /**
+     * @brief Returns the string of an ID, or an empty string for an unknown ID.
+     */
+    static std::string_view lookup(std::uint32_t id)
+    {
+        NameTable& table = instance();
+        std::shared_lock<std::shared_mutex> lock(table._mutex);
+        if (id >= table._names.size())
+            return {};
+        return table._names[id];
+    }
+
+    /**
+     * @brief Returns the number of interned strings, the empty one included.
+     */
+    static std::size_t size()
+    {
+        NameTable& table = instance();
+        std::shared_lock<std::shared_mutex> lock(table._mutex);
+        return table._names.size();
+    }
+
+private:
+    NameTable() : _names(1), _ids{{std::string_view(), EMPTY}} {}
+
+    static NameTable& instance()
+    {
+        static NameTable table;
+        return table;
+    }
+
+    std::shared_mutex _mutex;                                   /**< Guards both containers */
+    std::deque<std::string> _names;                             /**< Strings by ID */
+    std::unordered_map<std::string_view, std::uint32_t> _ids;   /**< ID of each string (keys view _names) */
+};
+
+/**
+ * @class EntityName
+ * @brief Debug name of an entity: a 32-bit handle into the NameTable.
+ *
+ * Builds implicitly from a string literal, a std::string or a string_view,
+ * so spawn calls keep passing plain strings. Interning a name already in the
+ * table does not allocate.
+ *
+ * With the RTYPE_ENTITY_NAMES CMake option OFF (RTYPE_NO_ENTITY_NAMES), names
+ * are compiled out: ENABLED is false, building an EntityName does nothing,
+ * the EntityManager keeps no per-entity name and every name reads as "".
+ */
+class EntityName {
+public:
+#ifdef RTYPE_NO_ENTITY_NAMES
+    static constexpr bool ENABLED = false;
+#else
+    static constexpr bool ENABLED = true;
+#endif
+
+    constexpr EntityName() noexcept = default;
+
+#ifdef RTYPE_NO_ENTITY_NAMES
+    constexpr EntityName(std::string_view) noexcept {}
+    constexpr EntityName(const char*) noexcept {}
+    constexpr EntityName(const std::string&) noexcept {}
+#else
+    EntityName(std::string_view name) : _id(NameTable::intern(name)) {}
+    EntityName(const char* name) : _id(NameTable::intern(name)) {}
+    EntityName(const std::string& name) : _id(NameTable::intern(name)) {}
+#endif
+
+    /** @return Handle in the NameTable */
+    constexpr std::uint32_t id() const noexcept { return _id; }
+
+    /** @return The name (valid for the whole program) */
+    std::string_view view() const { return NameTable::lookup(_id); }
+
+    constexpr bool operator==(const EntityName& other) const noexcept = default;
+
+private:
+    std::uint32_t _id = NameTable::EMPTY;   /**< Handle in the NameTable */
+};
+
+#endif /* !ENTITYNAME_HPP_ */
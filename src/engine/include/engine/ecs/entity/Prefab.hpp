@@ -0,0 +1,128 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** Prefab
+*/
+
+#ifndef PREFAB_HPP_
+#define PREFAB_HPP_
+
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/entity/Entity.hpp>
+#include <engine/ecs/entity/EntityName.hpp>
+#include <engine/ecs/Signature.hpp>
+
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class Prefab
+ * @brief Named bundle of default components to spawn entities from.
+ *
+ * A prefab is described once (its Signature is computed as components are
+ * added), then instantiated by GameEngine::spawnBatch() or
+ * GameEngine::applyPrefab(): every default is copied once into storage,
+ * with one EntityManager::addComponents() call per component type, and
+ * each entity is matched against systems once.
+ *
+ * @code
+ * Prefab bullet("Projectile", EntityCategory::LOCAL);
+ * bullet.with(Velocity(8.f, 0.f)).with(HitBox()).with<Team>(TeamType::PLAYER);
+ * @endcode
+ */
+class Prefab {
+public:
+    /**
+     * @brief Creates an empty prefab.
+     * @param name The name given to every instance.
+     * @param category The category of the instances (LOCAL or NETWORKED).
+     */
+    explicit Prefab(EntityName name, EntityCategory category = EntityCategory::LOCAL)
+        : _name(name), _category(category) {}
+
+    /**
+     * @brief Adds (or replaces) a default component.
+     * @tparam Component The type of the component.
+     * @param value The value copied into every instance.
+     * @return This prefab, for chaining.
+     */
+    template <class Component>
+    Prefab& with(Component value)
+    {
+        std::size_t typeId = EntityManager::getComponentTypeId<Component>();
+        Entry entry{typeId, std::make_shared<const Component>(std::move(value)),
+            [](EntityManager& em, std::span<const Entity> entities, const void* component) {
+                em.addComponents<Component>(entities, *static_cast<const Component*>(component));
+            }};
+        for (Entry& existing : _components) {
+            if (existing.typeId == typeId) {
+                existing = std::move(entry);
+                return *this;
+            }
+        }
+        _components.push_back(std::move(entry));
+        _signature.set(typeId);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the default value of a component, or nullptr if the prefab has none.
+     */
+    template <class Component>
+    const Component* get() const
+    {
+        std::size_t typeId = EntityManager::getComponentTypeId<Component>();
+        for (const Entry& entry : _components) {
+            if (entry.typeId == typeId)
+                return static_cast<const Component*>(entry.value.get());
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Writes every default component to the given entities.
+     */
+    void apply(EntityManager& em, std::span<const Entity> entities) const
+    {
+        for (const Entry& entry : _components)
+            entry.write(em, entities, entry.value.get());
+    }
+
+    /**
+     * @brief Writes every default component to one entity.
+     */
+    void apply(EntityManager& em, Entity const& entity) const
+    {
+        apply(em, std::span<const Entity>(&entity, 1));
+    }
+
+    /** @return The components of an instance, as a signature */
+    const Signature& getSignature() const { return _signature; }
+
+    /** @return The name given to every instance */
+    EntityName getName() const { return _name; }
+
+    /** @return The category of the instances */
+    EntityCategory getCategory() const { return _category; }
+
+    /** @return Number of default components */
+    std::size_t size() const { return _components.size(); }
+
+private:
+    struct Entry {
+        std::size_t typeId;                                                     /**< Component type ID */
+        std::shared_ptr<const void> value;                                      /**< Default component (immutable, shared by copies) */
+        void (*write)(EntityManager&, std::span<const Entity>, const void*);    /**< Copies the default into a batch */
+    };
+
+    EntityName _name;                   /**< Name of the instances (interned) */
+    EntityCategory _category;           /**< Category of the instances */
+    std::vector<Entry> _components;     /**< Default components, in declaration order */
+    Signature _signature;               /**< Bits of the default components */
+};
+
+#endif /* !PREFAB_HPP_ */
@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** PrefabRegistry
+*/
+
+#ifndef PREFABREGISTRY_HPP_
+#define PREFABREGISTRY_HPP_
+
+#include <engine/ecs/entity/Prefab.hpp>
+#include <common/error/Error.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * @class PrefabRegistry
+ * @brief Prefabs indexed by a dense key, built once at startup.
+ *
+ * Lookups are a vector index, so spawning code can fetch its prefab on
+ * every spawn at no cost.
+ *
+ * @tparam Key Enum (or integer) type whose values index the prefabs.
+ */
+template <class Key>
+class PrefabRegistry {
+public:
+    /**
+     * @brief Registers (or replaces) the prefab of a key.
+     * @return Reference to the stored prefab.
+     */
+    Prefab& add(Key key, Prefab prefab)
+    {
+        std::size_t index = static_cast<std::size_t>(key);
+        if (index >= _prefabs.size())
+            _prefabs.resize(index + 1);
+        _prefabs[index] = std::move(prefab);
+        return *_prefabs[index];
+    }
+
+    /**
+     * @brief Checks whether a key has a prefab.
+     */
+    bool has(Key key) const
+    {
+        std::size_t index = static_cast<std::size_t>(key);
+        return index < _prefabs.size() && _prefabs[index].has_value();
+    }
+
+    /**
+     * @brief Returns the prefab of a key.
+     * @throws ErrorType::EcsError if no prefab was registered for the key.
+     */
+    const Prefab& get(Key key) const
+    {
+        if (!has(key))
+            throw Error(ErrorType::EcsError, ErrorMessages::ECS_PREFAB_NOT_FOUND);
+        return *_prefabs[static_cast<std::size_t>(key)];
+    }
+
+private:
+    std::vector<std::optional<Prefab>> _prefabs;    /**< Prefab of each key, by key value */
+};
+
+#endif /* !PREFABREGISTRY_HPP_ */
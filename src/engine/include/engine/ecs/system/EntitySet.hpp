@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** EntitySet
+*/
+
+#ifndef ENTITYSET_HPP_
+#define ENTITYSET_HPP_
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @class EntitySet
+ * @brief Dense set of entity IDs with O(1) insertion, removal and lookup.
+ *
+ * IDs are packed in a vector (iteration order is insertion order, modified by
+ * removals) and a flat index maps each entity ID to its packed position.
+ * Removal is a swap-and-pop: the last ID takes the place of the removed one.
+ */
+class EntitySet {
+public:
+    using containerT = std::vector<std::size_t>;              /**< Packed ID container */
+    using constIterator = containerT::const_iterator;         /**< Iterator over packed IDs */
+
+    static constexpr std::uint32_t NPOS = std::numeric_limits<std::uint32_t>::max(); /**< Absent entity */
+
+    /**
+     * @brief Adds an entity to the set.
+     * @return True if the entity was not already present.
+     */
+    bool insert(std::size_t id)
+    {
+        if (id >= _index.size())
+            _index.resize(id + 1, NPOS);
+        if (_index[id] != NPOS)
+            return false;
+        _index[id] = static_cast<std::uint32_t>(_dense.size());
+        _dense.push_back(id);
+        return true;
+    }
+
+    /**
+     * @brief Removes an entity from the set.
+     * @return True if the entity was present.
+     */
+    bool erase(std::size_t id)
+    {
+        if (!contains(id))
+            return false;
+        std::uint32_t pos = _index[id];
+        std::size_t last = _dense.back();
+        _dense[pos] = last;
+        _index[last] = pos;
+        _dense.pop_back();
+        _index[id] = NPOS;
+        return true;
+    }
+
+    /**
+     * @brief Checks whether an entity belongs to the set.
+     */
+    bool contains(std::size_t id) const noexcept
+    {
+        return id < _index.size() && _index[id] != NPOS;
+    }
+
+    /** @brief Removes every entity from the set. */
+    void clear()
+    {
+        _dense.clear();
+        _index.clear();
+    }
+
+    /** @return Number of entities in the set */
+    std::size_t size() const noexcept { return _dense.size(); }
+
+    /** @return True if the set holds no entity */
+    bool empty() const noexcept { return _dense.empty(); }
+
+    /** @return Entity ID at a packed position */
+    std::size_t operator[](std::size_t pos) const { return _dense[pos]; }
+
+    /** @return Iterator to the first packed ID */
+    constIterator begin() const noexcept { return _dense.begin(); }
+
+    /** @return Iterator past the last packed ID */
+    constIterator end() const noexcept { return _dense.end(); }
+
+private:
+    containerT _dense;                  /**< Packed entity IDs */
+    std::vector<std::uint32_t> _index;  /**< Entity ID -> packed position (NPOS if absent) */
+};
+
+#endif /* !ENTITYSET_HPP_ */
@@ -8,8 +8,9 @@
 #ifndef SYSTEM_HPP_
 #define SYSTEM_HPP_
 
-#include <vector>
-#include <algorithm>
+#include <engine/ecs/system/EntitySet.hpp>
+
+#include <cstddef>
 
 /**
  * @class System
@@ -81,14 +82,15 @@ public:
      * @return True if present.
      */
     bool hasEntity(size_t id) const noexcept {
-        return std::find(_entities.begin(), _entities.end(), id) != _entities.end();
+        return _entities.contains(id);
     }
 
     friend class SystemManager;
 
 protected:
-    std::vector<size_t> _entities;  /**< List of entity IDs matching the system’s signature */
-    bool _running { false };        /**< Indicates whether the system is currently running */
+    EntitySet _entities;                /**< Dense set of entity IDs matching the system’s signature */
+    bool _running { false };            /**< Indicates whether the system is currently running */
+    size_t _systemIndex { 0 };          /**< Slot assigned by the SystemManager (membership cache bit) */
 };
 
 #endif /* !SYSTEM_HPP_ */
@@ -9,7 +9,9 @@
 #define SYSTEMMANAGER_HPP_
 
 #include <engine/ecs/system/System.hpp>
+#include <engine/ecs/system/ThreadPool.hpp>
 #include <engine/ecs/Signature.hpp>
+#include <engine/core/AllocationProfiler.hpp>
 #include <common/error/Error.hpp>
 #include <common/logger/Logger.hpp>
 
@@ -18,9 +20,121 @@
 #include <memory>
 #include <stdexcept>
 #include <algorithm>
+#include <array>
+#include <bitset>
+#include <vector>
+#include <functional>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <bit>
+#include <cstdint>
+
+#define MAX_SYSTEMS 64
+using SystemMask = std::bitset<MAX_SYSTEMS>; /**< One bit per system slot */
 
 class EntityManager;
 
+/**
+ * @enum SchedulerMode
+ * @brief How SystemManager::updateAll runs the systems.
+ */
+enum class SchedulerMode : uint8_t {
+    SEQUENTIAL = 0,     /**< One system after the other on the calling thread (deterministic, for replay and debugging) */
+    PARALLEL = 1        /**< Non-conflicting systems run together on a thread pool */
+};
+
+/**
+ * @enum SystemStage
+ * @brief Phases of a tick; updateAll() runs the stages in this order.
+ */
+enum class SystemStage : uint8_t {
+    INPUT = 0,              /**< Player input, UI interaction */
+    SIMULATION = 1,         /**< Gameplay logic (default stage) */
+    PHYSICS = 2,            /**< Motion integration, collisions */
+    POST_PHYSICS = 3,       /**< Reactions to the physics results (damage, cleanup, HUD) */
+    NETWORK_EXTRACT = 4,    /**< Reading the state to replicate */
+    RENDER = 5,             /**< Drawing and audio */
+    COUNT = 6               /**< Number of stages */
+};
+
+static constexpr size_t STAGE_COUNT = static_cast<size_t>(SystemStage::COUNT);
+
+/**
+ * @struct FixedRate
+ * @brief Accumulator running a stage or a system at a fixed frequency.
+ */
+struct FixedRate {
+    static constexpr size_t MAX_STEPS = 5;  /**< Steps per update before dropping the backlog */
+
+    float step = 0.f;           /**< Seconds per step, 0 to run on every update */
+    float accumulated = 0.f;    /**< Time not yet consumed by a step */
+
+    /**
+     * @brief Adds elapsed time and returns how many steps are due.
+     */
+    size_t advance(float dt)
+    {
+        if (step <= 0.f)
+            return 1;
+        accumulated += dt;
+        size_t steps = 0;
+        while (accumulated >= step && steps < MAX_STEPS) {
+            accumulated -= step;
+            ++steps;
+        }
+        if (accumulated >= step)
+            accumulated = 0.f;
+        return steps;
+    }
+
+    /**
+     * @brief Returns the delta time handed to each step.
+     */
+    float delta(float dt) const { return step > 0.f ? step : dt; }
+};
+
+/**
+ * @struct SystemAccess
+ * @brief Components a system reads and writes.
+ *
+ * A system that never declared its access is exclusive: it conflicts with
+ * every other system and always runs alone, on the calling thread.
+ */
+struct SystemAccess {
+    Signature reads;            /**< Components only read */
+    Signature writes;           /**< Components written */
+    bool declared = false;      /**< Whether reads/writes were declared */
+
+    /**
+     * @brief Checks whether two systems may not run at the same time.
+     */
+    bool conflictsWith(const SystemAccess& other) const
+    {
+        if (!declared || !other.declared)
+            return true;
+        return (writes & (other.reads | other.writes)).any() || (other.writes & reads).any();
+    }
+};
+
+/**
+ * @struct SystemDeleter
+ * @brief Deleter of the registered systems; attached systems are owned elsewhere (see SystemManager::attachSystem()).
+ */
+struct SystemDeleter {
+    bool owned = true;  /**< Whether the manager created (and must delete) the system */
+
+    void operator()(System* system) const
+    {
+        if (owned)
+            delete system;
+    }
+};
+
+using SystemPtr = std::unique_ptr<System, SystemDeleter>; /**< Registered system */
+
 /**
  * @class SystemManager
  * @brief Centralizes the management of systems.
@@ -30,11 +144,30 @@ class EntityManager;
  *  - maintains a required signature for each system;
  *  - automatically updates the list of entities inside each system when an entity’s signature changes;
  *  - invokes lifecycle callbacks (create, destroy, update) on all systems.
+ *
+ * Each system owns a slot index; the manager caches, per entity, which slots
+ * the entity currently belongs to, so a signature change only touches the
+ * systems whose match result actually flipped. View queries whose signature
+ * matches no system get a slot of their own (see getMatches()).
+ *
+ * Systems run stage by stage (see SystemStage), in registration order inside
+ * a stage. A stage or a single system may run at a fixed rate instead of on
+ * every update. In PARALLEL mode, the systems of a stage that declared
+ * their component access are grouped into batches of mutually compatible
+ * systems (a system always runs after every earlier system it conflicts
+ * with), and each batch is spread over a work-stealing ThreadPool.
  */
 class SystemManager {
 
 public:
-    SystemManager() = default;
+    /**
+     * @brief Reserves every slot up front.
+     *
+     * Systems of a PARALLEL batch hold references into _slots while another
+     * system of the batch may register a view query, so the slot storage
+     * must never reallocate.
+     */
+    SystemManager() { _slots.reserve(MAX_SYSTEMS); }
     ~SystemManager() = default;
 
     /**
@@ -43,7 +176,7 @@ public:
     void setEntityManager(EntityManager* em) { _entityManager = em; }
 
     /**
-     * @brief Adds a system to the manager.
+     * @brief Adds a system to the SIMULATION stage.
      * @tparam S System type derived from System.
      * @tparam Args Forwarded arguments passed to the system constructor.
      * @return Reference to the newly added system.
@@ -51,14 +184,61 @@ public:
      */
     template <class S, class... Args>
     S& addSystem(Args&&... args)
+    {
+        return addSystem<S>(SystemStage::SIMULATION, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Adds a system to a stage, after the systems already in that stage.
+     * @tparam S System type derived from System.
+     * @tparam Args Forwarded arguments passed to the system constructor.
+     * @param stage Stage running the system.
+     * @return Reference to the newly added system.
+     * @throws ErrorType::EcsDuplicateSystem if the system is already registered.
+     */
+    template <class S, class... Args>
+    S& addSystem(SystemStage stage, Args&&... args)
     {
         static_assert(std::is_base_of_v<System, S>, "S must derive from System");
 
         std::type_index key(typeid(S));
-        auto [it, inserted] = _systems.try_emplace(key, std::make_unique<S>(std::forward<Args>(args)...));
-        if (!inserted)
+        if (_systems.find(key) != _systems.end())
             throw Error(ErrorType::EcsDuplicateSystem, ErrorMessages::ECS_DUPLICATE_SYSTEM);
-        return static_cast<S&>(*it->second);
+
+        S& system = static_cast<S&>(registerSystem(key, SystemPtr(new S(std::forward<Args>(args)...))));
+        size_t index = system._systemIndex;
+        _slots[index].stage = stage;
+        auto position = std::upper_bound(_order.begin(), _order.end(), stage, [this](SystemStage st, size_t slot) {
+            return st < _slots[slot].stage;
+        });
+        _order.insert(position, index);
+        _batchesDirty = true;
+        return system;
+    }
+
+    /**
+     * @brief Registers a system owned and run by someone else (e.g. a SystemPipeline).
+     *
+     * The system gets a slot like any other: its entity list is maintained
+     * on every signature change and getSystem(), setSignature() or views
+     * find it. It is not part of the update order though: updateAll() and
+     * the lifecycle calls skip it. It must be detached with deleteSystem()
+     * before it is destroyed.
+     * @tparam S System type derived from System.
+     * @param system System to register.
+     * @return The system.
+     * @throws ErrorType::EcsDuplicateSystem if the system is already registered.
+     */
+    template <class S>
+    S& attachSystem(S& system)
+    {
+        static_assert(std::is_base_of_v<System, S>, "S must derive from System");
+
+        std::type_index key(typeid(S));
+        if (_systems.find(key) != _systems.end())
+            throw Error(ErrorType::EcsDuplicateSystem, ErrorMessages::ECS_DUPLICATE_SYSTEM);
+        registerSystem(key, SystemPtr(&system, SystemDeleter{false}));
+        return system;
     }
 
     /**
@@ -69,7 +249,15 @@ public:
     void deleteSystem()
     {
         std::type_index key(typeid(S));
-        _systems.erase(key);
+        auto it = _systems.find(key);
+        if (it == _systems.end())
+            return;
+        size_t index = it->second->_systemIndex;
+        _order.erase(std::remove(_order.begin(), _order.end(), index), _order.end());
+        _batchesDirty = true;
+        releaseSlot(index);
+        _signatures.erase(key);
+        _systems.erase(it);
     }
 
     /**
@@ -121,40 +309,214 @@ public:
     template<class S>
     void setSignature(const Signature& sig)
     {
-        if (!hasSystem<S>())
+        auto it = _systems.find(typeid(S));
+        if (it == _systems.end())
             throw Error(ErrorType::EcsInvalidSystem, ErrorMessages::ECS_SYSTEM_NOT_FOUND);
         _signatures[typeid(S)] = sig;
+
+        SystemSlot& slot = _slots[it->second->_systemIndex];
+        slot.signature = sig;
+        slot.hasSignature = true;
+        indexSlot(it->second->_systemIndex);
+    }
+
+    /**
+     * @brief Declares the components a system only reads.
+     *
+     * Only systems with a declared access (reads and/or writes) may run in
+     * parallel; they must not touch other components or shared state, and
+     * may only record structural changes through the CommandBuffer.
+     * @tparam S System type.
+     * @param reads Components only read.
+     * @throws ErrorType::EcsInvalidSystem if the system does not exist.
+     */
+    template<class S>
+    void setReads(const Signature& reads)
+    {
+        SystemAccess& access = accessOf<S>();
+        access.reads = reads;
+        access.declared = true;
+        _batchesDirty = true;
+    }
+
+    /**
+     * @brief Declares the components a system writes (see setReads()).
+     * @tparam S System type.
+     * @param writes Components written.
+     * @throws ErrorType::EcsInvalidSystem if the system does not exist.
+     */
+    template<class S>
+    void setWrites(const Signature& writes)
+    {
+        SystemAccess& access = accessOf<S>();
+        access.writes = writes;
+        access.declared = true;
+        _batchesDirty = true;
+    }
+
+    /**
+     * @brief Returns the declared component access of a system.
+     *
+     * The reference stays valid (and reflects later setReads()/setWrites()
+     * calls) until the system is deleted.
+     * @tparam S System type.
+     * @throws ErrorType::EcsInvalidSystem if the system does not exist.
+     */
+    template<class S>
+    const SystemAccess& getAccess()
+    {
+        return accessOf<S>();
+    }
+
+    /**
+     * @brief Runs a whole stage at a fixed frequency.
+     * @param stage Stage to throttle.
+     * @param hz Steps per second, 0 to run on every update.
+     */
+    void setStageRate(SystemStage stage, float hz)
+    {
+        _stageRates[static_cast<size_t>(stage)] = FixedRate{hz > 0.f ? 1.f / hz : 0.f, 0.f};
+    }
+
+    /**
+     * @brief Runs one system at a fixed frequency inside its stage.
+     * @tparam S System type.
+     * @param hz Steps per second, 0 to run on every update.
+     * @throws ErrorType::EcsInvalidSystem if the system does not exist.
+     */
+    template<class S>
+    void setRate(float hz)
+    {
+        auto it = _systems.find(typeid(S));
+        if (it == _systems.end())
+            throw Error(ErrorType::EcsInvalidSystem, ErrorMessages::ECS_SYSTEM_NOT_FOUND);
+        _slots[it->second->_systemIndex].rate = FixedRate{hz > 0.f ? 1.f / hz : 0.f, 0.f};
     }
 
+    /**
+     * @brief Selects how updateAll() runs the systems.
+     * @param mode SEQUENTIAL or PARALLEL.
+     * @param threads Worker threads in PARALLEL mode (0 = one per hardware thread, minus the caller).
+     */
+    void setSchedulerMode(SchedulerMode mode, size_t threads = 0)
+    {
+        _mode = mode;
+        _pool.reset();
+        if (mode == SchedulerMode::PARALLEL) {
+            if (threads == 0) {
+                size_t hardware = std::thread::hardware_concurrency();
+                threads = hardware > 1 ? hardware - 1 : 1;
+            }
+            _pool = std::make_unique<ThreadPool>(threads);
+        }
+    }
+
+    /**
+     * @brief Returns how updateAll() runs the systems.
+     */
+    SchedulerMode getSchedulerMode() const noexcept { return _mode; }
+
+    /**
+     * @brief Returns the rank (position in update order) of the system running on this thread.
+     * @return The rank, or NO_SYSTEM outside of updateAll().
+     */
+    static size_t runningSystemRank() noexcept { return _runningRank; }
+
+    static constexpr size_t NO_SYSTEM = std::numeric_limits<size_t>::max(); /**< See runningSystemRank() */
+
     /**
      * @brief Notifies the SystemManager that an entity's signature has changed.
      *
      * This method:
      *  - checks whether the entity matches the signature of each system;
-     *  - adds or removes the entity from each system accordingly.
+     *  - adds or removes the entity from each system whose match result changed.
      *
      * @param entity Entity ID.
      * @param entitySig Signature of the entity.
      */
     void entitySignatureChanged(size_t entity, const Signature& entitySig)
     {
-        for (auto& [type, system] : _systems) {
+        SystemMask& cached = matchesOf(entity);
+        for (size_t index = 0; index < _slots.size(); ++index)
+            rematch(entity, entitySig, index, cached);
+    }
 
-            auto it = _signatures.find(type);
-            if (it == _signatures.end())
-                throw Error(ErrorType::EcsMissingSignature, ErrorMessages::ECS_MISSING_SIGNATURE);
+    /**
+     * @brief Notifies the SystemManager that some components of an entity were added or removed.
+     *
+     * Only the systems and queries whose signature contains one of the
+     * changed components are re-tested (plus those without a signature,
+     * which match everything); the others cannot have changed their answer.
+     *
+     * @param entity Entity ID.
+     * @param entitySig Signature of the entity.
+     * @param changed Components added or removed since the last notification.
+     */
+    void entitySignatureChanged(size_t entity, const Signature& entitySig, const Signature& changed)
+    {
+        static_assert(MAX_COMPONENTS <= 64, "entitySignatureChanged() walks a Signature as one 64-bit word");
+        static_assert(MAX_SYSTEMS <= 64, "entitySignatureChanged() walks a SystemMask as one 64-bit word");
+        SystemMask& cached = matchesOf(entity);
+        SystemMask candidates = _unconditional;
+        for (std::uint64_t bits = changed.to_ullong(); bits != 0; bits &= bits - 1)
+            candidates |= _dependents[std::countr_zero(bits)];
+        for (std::uint64_t bits = candidates.to_ullong(); bits != 0; bits &= bits - 1)
+            rematch(entity, entitySig, std::countr_zero(bits), cached);
+    }
 
-            const Signature& systemSig = it->second;
-            bool matches = (entitySig & systemSig) == systemSig;
-            
-            LOG_DEBUG("entitySignatureChanged: entity={} system={} entitySig={} systemSig={} matches={}",
-                      entity, type.name(), entitySig.to_string(), systemSig.to_string(), matches);
+    /**
+     * @brief Grows the per-entity match cache to cover every entity ID below count.
+     *
+     * Called by the EntityManager whenever its signature table grows, i.e.
+     * between batches, so that getMatches() never has to resize the cache
+     * from a worker thread.
+     * @param count Number of entity IDs to cover.
+     */
+    void reserveEntities(size_t count)
+    {
+        if (count > _entityMatches.size())
+            _entityMatches.resize(count);
+    }
+
+    /**
+     * @brief Returns the cached list of entities matching a signature.
+     *
+     * The list of a system with the same signature is reused; otherwise a
+     * query slot is registered, seeded from the candidates, and from then on
+     * maintained by entitySignatureChanged() like any system.
+     *
+     * @param sig Required signature.
+     * @param candidates Entities that may match (e.g. the smallest pool of the signature).
+     * @param signatures Current signature of every entity, indexed by ID (no
+     *        larger than the size given to reserveEntities()).
+     * @throws ErrorType::EcsError if MAX_SYSTEMS systems and queries are already registered.
+     */
+    const EntitySet& getMatches(const Signature& sig, const std::vector<size_t>& candidates,
+        const std::vector<Signature>& signatures)
+    {
+        // Systems running in parallel may build views at the same time
+        std::lock_guard<std::mutex> lock(_queryMutex);
 
-            if (matches)
-                addEntityToSystem(system.get(), entity);
-            else
-                removeEntityFromSystem(system.get(), entity);
+        for (const SystemSlot& slot : _slots) {
+            if (slot.entities && slot.hasSignature && slot.signature == sig)
+                return *slot.entities;
         }
+
+        size_t index = allocateSlot();
+        SystemSlot& slot = _slots[index];
+        slot.query = std::make_unique<EntitySet>();
+        slot.entities = slot.query.get();
+        slot.signature = sig;
+        slot.hasSignature = true;
+        indexSlot(index);
+
+        for (size_t entity : candidates) {
+            if (entity >= signatures.size() || (signatures[entity] & sig) != sig)
+                continue;
+            _entityMatches[entity].set(index);
+            slot.entities->insert(entity);
+        }
+        return *slot.entities;
     }
 
     /**
@@ -162,8 +524,8 @@ public:
      */
     void onCreateAll()
     {
-        for (auto& [_, sys] : _systems)
-            sys->onCreate();
+        for (size_t index : _order)
+            _slots[index].system->onCreate();
     }
 
     /**
@@ -171,8 +533,8 @@ public:
      */
     void onDestroyAll()
     {
-        for (auto& [_, sys] : _systems)
-            sys->onDestroy();
+        for (size_t index : _order)
+            _slots[index].system->onDestroy();
     }
 
     /**
@@ -180,9 +542,9 @@ public:
      */
     void onStartRunningAll()
     {
-        for (auto& [_, sys] : _systems) {
-            sys->_running = true;
-            sys->onStartRunning();
+        for (size_t index : _order) {
+            _slots[index].system->_running = true;
+            _slots[index].system->onStartRunning();
         }
     }
 
@@ -191,47 +553,396 @@ public:
      */
     void onStopRunningAll()
     {
-        for (auto& [_, sys] : _systems) {
-            sys->_running = false;
-            sys->onStopRunning();
+        for (size_t index : _order) {
+            _slots[index].system->_running = false;
+            _slots[index].system->onStopRunning();
         }
     }
 
     /**
-     * @brief Updates all systems.
+     * @brief Sets the callback run at each sync point of updateAll().
+     *
+     * Used to flush deferred structural changes (see CommandBuffer) between systems.
+     * @param syncPoint Callback, or an empty function to disable it.
+     */
+    void setSyncPoint(std::function<void()> syncPoint) { _syncPoint = std::move(syncPoint); }
+
+    /**
+     * @brief Runs the sync point callback, for systems run outside of updateAll().
+     */
+    void sync()
+    {
+        if (_syncPoint)
+            _syncPoint();
+    }
+
+    /**
+     * @brief Updates all systems, stage by stage, in registration order inside a stage.
+     *
+     * A fixed-rate stage runs as many times as its rate requires (possibly
+     * none) and its systems receive the stage step as delta time. In
+     * SEQUENTIAL mode a sync point follows each system, so structural
+     * changes it recorded are applied before the next system iterates. In
+     * PARALLEL mode the sync point follows each batch; a batch never spans
+     * two stages.
      * @param dt Delta time.
      */
     void updateAll(float dt)
     {
-        for (auto& [_, sys] : _systems)
-            sys->onUpdate(dt);
+        bool parallel = _mode == SchedulerMode::PARALLEL && _pool;
+
+        if (_batchesDirty)
+            buildBatches();
+        for (size_t stage = 0; stage < STAGE_COUNT; ++stage) {
+            if (_stageBegin[stage] == _stageBegin[stage + 1])
+                continue;
+            FixedRate& rate = _stageRates[stage];
+            size_t steps = rate.advance(dt);
+            for (size_t step = 0; step < steps; ++step) {
+                if (parallel)
+                    runStageBatches(stage, rate.delta(dt));
+                else
+                    runStageSystems(stage, rate.delta(dt));
+            }
+        }
+    }
+
+    /**
+     * @brief Runs count tasks together: task(0) on the calling thread, the others on the pool.
+     *
+     * Task i runs with ranks[i] as runningSystemRank(), so the commands it
+     * records are flushed in rank order. Waits for every task, then rethrows
+     * the exception of the earliest failing one, if any. Without a pool
+     * (SEQUENTIAL mode) the tasks run one after another on the calling thread.
+     * @param ranks Rank of each task, at most MAX_SYSTEMS of them.
+     * @param count Number of tasks, none is a no-op.
+     * @param task Callable taking the task index.
+     */
+    template <class Task>
+    void runParallel(const size_t* ranks, size_t count, Task&& task)
+    {
+        if (count == 0)
+            return;
+        if (count == 1 || !_pool) {
+            for (size_t i = 0; i < count; ++i)
+                runRanked(ranks[i], [&task, i]() { task(i); });
+            return;
+        }
+
+        // Shared by reference so each submitted closure fits std::function's local storage
+        struct Shared {
+            Task& task;
+            const size_t* ranks;
+            std::array<std::exception_ptr, MAX_SYSTEMS> errors{};
+            std::atomic<size_t> remaining;
+        } shared{task, ranks, {}, count - 1};
+
+        for (size_t i = 1; i < count; ++i) {
+            _pool->submit([&shared, i]() {
+                try {
+                    runRanked(shared.ranks[i], [&shared, i]() { shared.task(i); });
+                } catch (...) {
+                    shared.errors[i] = std::current_exception();
+                }
+                shared.remaining.fetch_sub(1, std::memory_order_release);
+            });
+        }
+        try {
+            runRanked(ranks[0], [&task]() { task(0); });
+        } catch (...) {
+            shared.errors[0] = std::current_exception();
+        }
+        while (shared.remaining.load(std::memory_order_acquire) > 0) {
+            if (!_pool->runPending())
+                std::this_thread::yield();
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            if (shared.errors[i])
+                std::rethrow_exception(shared.errors[i]);
+        }
+    }
+
+    /**
+     * @brief Groups systems into batches of mutually compatible ones.
+     *
+     * Each system goes right after the last earlier system it conflicts
+     * with, so batch level[i] of system i is one more than the highest
+     * level of the earlier systems it conflicts with.
+     * @param access Declared access of each system, in update order.
+     * @param count Number of systems.
+     * @param level Receives the batch of each system.
+     * @return Number of batches.
+     */
+    static size_t assignBatchLevels(const SystemAccess* const* access, size_t count, size_t* level)
+    {
+        size_t levels = 0;
+        for (size_t r = 0; r < count; ++r) {
+            level[r] = 0;
+            for (size_t earlier = 0; earlier < r; ++earlier) {
+                if (access[r]->conflictsWith(*access[earlier]))
+                    level[r] = std::max(level[r], level[earlier] + 1);
+            }
+            levels = std::max(levels, level[r] + 1);
+        }
+        return levels;
+    }
+
+    /**
+     * @brief Returns the PARALLEL batches of every stage, as ranks in update order.
+     */
+    const std::vector<std::vector<size_t>>& getBatches()
+    {
+        if (_batchesDirty)
+            buildBatches();
+        return _batches;
     }
 
 private:
 
     /**
-     * @brief Adds an entity to a system if not already present.
+     * @brief Flat per-system data read on every signature change.
+     */
+    struct SystemSlot {
+        System* system = nullptr;               /**< Owning system, nullptr for a query or a free slot */
+        EntitySet* entities = nullptr;          /**< Match list to maintain, nullptr when the slot is free */
+        std::unique_ptr<EntitySet> query;       /**< Match list owned by a query slot */
+        Signature signature;                    /**< Required signature */
+        bool hasSignature = false;              /**< Whether setSignature() was called */
+        SystemAccess access;                    /**< Declared component access */
+        SystemStage stage = SystemStage::SIMULATION; /**< Stage running the system */
+        FixedRate rate;                         /**< Own rate inside the stage */
+    };
+
+    template<class S>
+    SystemAccess& accessOf()
+    {
+        auto it = _systems.find(typeid(S));
+        if (it == _systems.end())
+            throw Error(ErrorType::EcsInvalidSystem, ErrorMessages::ECS_SYSTEM_NOT_FOUND);
+        return _slots[it->second->_systemIndex].access;
+    }
+
+    /**
+     * @brief Runs the systems of a stage one after another.
+     */
+    void runStageSystems(size_t stage, float dt)
+    {
+        for (size_t rank = _stageBegin[stage]; rank < _stageBegin[stage + 1]; ++rank) {
+            SystemSlot& slot = _slots[_order[rank]];
+            runRanked(rank, [&slot, dt]() { runSystem(slot, dt); });
+            if (_syncPoint)
+                _syncPoint();
+        }
+    }
+
+    /**
+     * @brief Runs the PARALLEL batches of a stage.
+     */
+    void runStageBatches(size_t stage, float dt)
+    {
+        for (size_t b = _stageBatchBegin[stage]; b < _stageBatchBegin[stage + 1]; ++b) {
+            runBatch(_batches[b], dt);
+            if (_syncPoint)
+                _syncPoint();
+        }
+    }
+
+    /**
+     * @brief Calls a function with rank exposed to runningSystemRank().
+     */
+    template <class Fn>
+    static void runRanked(size_t rank, Fn&& fn)
+    {
+        _runningRank = rank;
+        try {
+            fn();
+        } catch (...) {
+            _runningRank = NO_SYSTEM;
+            throw;
+        }
+        _runningRank = NO_SYSTEM;
+    }
+
+    /**
+     * @brief Runs one system as many times as its rate requires.
+     */
+    static void runSystem(SystemSlot& slot, float dt)
+    {
+        size_t steps = slot.rate.advance(dt);
+        PROFILE_ALLOCATIONS(typeid(*slot.system).name());
+        for (size_t step = 0; step < steps; ++step)
+            slot.system->onUpdate(slot.rate.delta(dt));
+    }
+
+    /**
+     * @brief Computes the stage ranges, then groups the systems of each stage into batches.
+     *
+     * Inside a stage, each system goes right after the last earlier system
+     * it conflicts with.
+     */
+    void buildBatches()
+    {
+        _batches.clear();
+        size_t rank = 0;
+        for (size_t stage = 0; stage < STAGE_COUNT; ++stage) {
+            _stageBegin[stage] = rank;
+            _stageBatchBegin[stage] = _batches.size();
+            size_t end = rank;
+            while (end < _order.size() && static_cast<size_t>(_slots[_order[end]].stage) == stage)
+                ++end;
+
+            std::vector<const SystemAccess*> access;
+            for (size_t r = rank; r < end; ++r)
+                access.push_back(&_slots[_order[r]].access);
+            std::vector<size_t> level(end - rank, 0);
+            size_t levels = assignBatchLevels(access.data(), access.size(), level.data());
+            _batches.resize(_batches.size() + levels);
+            for (size_t r = rank; r < end; ++r)
+                _batches[_stageBatchBegin[stage] + level[r - rank]].push_back(r);
+            rank = end;
+        }
+        _stageBegin[STAGE_COUNT] = rank;
+        _stageBatchBegin[STAGE_COUNT] = _batches.size();
+        _batchesDirty = false;
+    }
+
+    /**
+     * @brief Runs a batch: the first system on the calling thread, the others on the pool (see runParallel()).
+     */
+    void runBatch(const std::vector<size_t>& batch, float dt)
+    {
+        runParallel(batch.data(), batch.size(), [this, &batch, dt](size_t i) {
+            runSystem(_slots[_order[batch[i]]], dt);
+        });
+    }
+
+    /**
+     * @brief Stores a system and gives it a slot, outside of the update order.
      */
-    void addEntityToSystem(System* sys, size_t entity)
+    System& registerSystem(std::type_index key, SystemPtr system)
     {
-        auto& vec = sys->_entities;
-        if (std::find(vec.begin(), vec.end(), entity) == vec.end())
-            vec.push_back(entity);
+        size_t index = allocateSlot();
+        auto [it, inserted] = _systems.try_emplace(key, std::move(system));
+        it->second->_systemIndex = index;
+        _slots[index].system = it->second.get();
+        _slots[index].entities = &it->second->_entities;
+        indexSlot(index);
+        return *it->second;
     }
 
     /**
-     * @brief Removes an entity from a system.
+     * @brief Reserves a slot index for a new system.
+     * @throws ErrorType::EcsError if MAX_SYSTEMS systems and queries are already registered.
      */
-    void removeEntityFromSystem(System* sys, size_t entity)
+    size_t allocateSlot()
     {
-        auto& vec = sys->_entities;
-        vec.erase(std::remove(vec.begin(), vec.end(), entity), vec.end());
+        if (!_freeSlots.empty()) {
+            size_t index = _freeSlots.back();
+            _freeSlots.pop_back();
+            return index;
+        }
+        if (_slots.size() >= MAX_SYSTEMS)
+            throw Error(ErrorType::EcsError, ErrorMessages::ECS_TOO_MANY_SYSTEMS);
+        _slots.emplace_back();
+        return _slots.size() - 1;
+    }
+
+    /**
+     * @brief Frees a slot index and forgets every cached membership bit using it.
+     */
+    void releaseSlot(size_t index)
+    {
+        _slots[index] = SystemSlot{};
+        indexSlot(index);
+        for (auto& mask : _entityMatches)
+            mask.reset(index);
+        _freeSlots.push_back(index);
+    }
+
+    /**
+     * @brief Records which components a slot depends on, for the routed entitySignatureChanged().
+     *
+     * A slot without a signature (or with an empty one) is re-tested on
+     * every change, so that the missing signature is still reported.
+     */
+    void indexSlot(size_t index)
+    {
+        for (auto& mask : _dependents)
+            mask.reset(index);
+        _unconditional.reset(index);
+
+        const SystemSlot& slot = _slots[index];
+        if (!slot.entities)
+            return;
+        if (!slot.hasSignature || slot.signature.none()) {
+            _unconditional.set(index);
+            return;
+        }
+        for (size_t bit = 0; bit < MAX_COMPONENTS; ++bit) {
+            if (slot.signature.test(bit))
+                _dependents[bit].set(index);
+        }
+    }
+
+    /**
+     * @brief Returns the cached system membership of an entity, growing the cache if needed.
+     */
+    SystemMask& matchesOf(size_t entity)
+    {
+        if (entity >= _entityMatches.size())
+            _entityMatches.resize(entity + 1);
+        return _entityMatches[entity];
+    }
+
+    /**
+     * @brief Re-tests an entity against one slot and updates its entity set.
+     * @throws ErrorType::EcsMissingSignature if the slot is a system without signature.
+     */
+    void rematch(size_t entity, const Signature& entitySig, size_t index, SystemMask& cached)
+    {
+        SystemSlot& slot = _slots[index];
+        if (!slot.entities)
+            return;
+        if (!slot.hasSignature)
+            throw Error(ErrorType::EcsMissingSignature, ErrorMessages::ECS_MISSING_SIGNATURE);
+
+        bool matches = (entitySig & slot.signature) == slot.signature;
+        if (matches == cached.test(index))
+            return;
+
+        LOG_DEBUG("entitySignatureChanged: entity={} system={} entitySig={} systemSig={} matches={}",
+                  entity, slot.system ? typeid(*slot.system).name() : "query",
+                  entitySig.to_string(), slot.signature.to_string(), matches);
+
+        cached.set(index, matches);
+        if (matches)
+            slot.entities->insert(entity);
+        else
+            slot.entities->erase(entity);
     }
 
 private:
     EntityManager* _entityManager = nullptr;                           /**< Linked EntityManager */
-    std::unordered_map<std::type_index, std::unique_ptr<System>> _systems;   /**< All registered systems */
+    std::unordered_map<std::type_index, SystemPtr> _systems;                 /**< All registered systems */
     std::unordered_map<std::type_index, Signature> _signatures;             /**< Required signatures for each system */
+    std::vector<SystemSlot> _slots;                                          /**< Systems and queries indexed by slot, never reallocated */
+    std::vector<size_t> _freeSlots;                                          /**< Slots released by deleteSystem() */
+    std::vector<SystemMask> _entityMatches;                                  /**< Per-entity cached system membership */
+    std::array<SystemMask, MAX_COMPONENTS> _dependents{};                    /**< Slots whose signature contains each component */
+    SystemMask _unconditional;                                               /**< Slots re-tested on every change (no or empty signature) */
+    std::function<void()> _syncPoint;                                        /**< Run after each system (or batch) in updateAll() */
+    std::vector<size_t> _order;                                              /**< System slots by stage, then registration order */
+    std::array<size_t, STAGE_COUNT + 1> _stageBegin{};                       /**< First rank of each stage in _order */
+    std::array<size_t, STAGE_COUNT + 1> _stageBatchBegin{};                  /**< First batch of each stage in _batches */
+    std::array<FixedRate, STAGE_COUNT> _stageRates{};                        /**< Rate of each stage */
+    SchedulerMode _mode = SchedulerMode::SEQUENTIAL;                         /**< How updateAll() runs */
+    std::unique_ptr<ThreadPool> _pool;                                       /**< Workers of PARALLEL mode */
+    std::vector<std::vector<size_t>> _batches;                               /**< PARALLEL batches, as ranks in _order */
+    bool _batchesDirty = true;                                               /**< Stage ranges and _batches must be rebuilt */
+    std::mutex _queryMutex;                                                  /**< Serializes getMatches() */
+
+    inline static thread_local size_t _runningRank = NO_SYSTEM;             /**< Rank of the system running on this thread */
 };
 
 #endif /* !SYSTEMMANAGER_HPP_ */
@@ -0,0 +1,253 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** SystemPipeline
+*/
+
+#ifndef SYSTEMPIPELINE_HPP_
+#define SYSTEMPIPELINE_HPP_
+
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/component/View.hpp>
+#include <engine/core/AllocationProfiler.hpp>
+
+#include <array>
+#include <optional>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+
+/**
+ * @struct ComponentList
+ * @brief Compile-time list of component types.
+ *
+ * A system run by a SystemPipeline may declare its signature as
+ * `using Components = ComponentList<Transform, Velocity>;` (see SystemPipeline).
+ */
+template <class... Components>
+struct ComponentList {};
+
+/**
+ * @class SystemPipeline
+ * @brief Fixed, compile-time list of systems run in order without virtual dispatch.
+ *
+ * The pipeline holds its systems by value and attaches them to the
+ * SystemManager (see SystemManager::attachSystem()), so their entity lists
+ * are maintained as usual and getSystem() still finds them, but updateAll()
+ * does not run them: update() does, in the order of the template arguments,
+ * with a non-virtual call and a sync point (CommandBuffer flush) after each
+ * system.
+ *
+ * When the SystemManager is in PARALLEL mode, the systems are grouped by
+ * their declared access (SystemManager::setReads()/setWrites()) exactly
+ * like the batches of updateAll(): each batch runs on the SystemManager
+ * thread pool and the sync point follows each batch. Systems without a
+ * declared access still run alone.
+ *
+ * A system declaring `using Components = ComponentList<...>;` gets that
+ * signature, and the view over those components is resolved once at
+ * construction. If the system has an `update(float, View<...>&)` member,
+ * update() calls it with that view instead of onUpdate(float):
+ *
+ * @code
+ * class MovementSystem : public System {
+ * public:
+ *     using Components = ComponentList<Transform, Velocity>;
+ *     void update(float dt, View<Transform, Velocity>& view);
+ *     void onUpdate(float dt) override; // when registered in a SystemManager
+ * };
+ *
+ * SystemPipeline<PlayerSystem, MovementSystem> pipeline(entities, systems,
+ *     std::forward_as_tuple(engine), std::forward_as_tuple(engine));
+ * pipeline.update(dt);
+ * @endcode
+ *
+ * Each constructor argument after the managers is the tuple of constructor
+ * arguments of one system. The components must be registered before the
+ * pipeline is built, and the pipeline must be destroyed before the managers.
+ *
+ * @tparam Systems System types derived from System, in update order.
+ */
+template <class... Systems>
+class SystemPipeline {
+    static_assert(sizeof...(Systems) > 0, "A pipeline needs at least one system");
+    static_assert((std::is_base_of_v<System, Systems> && ...), "Systems must derive from System");
+
+public:
+    /**
+     * @brief Builds every system in place, attaches it, then resolves its view.
+     * @param entities EntityManager the systems iterate.
+     * @param systems SystemManager maintaining the entity lists.
+     * @param args One tuple of constructor arguments per system (std::forward_as_tuple).
+     * @throws ErrorType::EcsDuplicateSystem if a system is already registered.
+     */
+    template <class... ArgTuples>
+    explicit SystemPipeline(EntityManager& entities, SystemManager& systems, ArgTuples&&... args)
+        : _systemManager(systems), _stages(std::forward<ArgTuples>(args)...)
+    {
+        static_assert(sizeof...(ArgTuples) == sizeof...(Systems), "One argument tuple per system");
+        std::apply([&](auto&... stages) { (attach(entities, stages), ...); }, _stages);
+        _access = {&_systemManager.getAccess<Systems>()...};
+    }
+
+    SystemPipeline(const SystemPipeline&) = delete;
+    SystemPipeline& operator=(const SystemPipeline&) = delete;
+
+    /**
+     * @brief Detaches the systems from the SystemManager.
+     */
+    ~SystemPipeline()
+    {
+        std::apply([this](auto&... stages) {
+            (_systemManager.deleteSystem<typename std::remove_reference_t<decltype(stages)>::SystemType>(), ...);
+        }, _stages);
+    }
+
+    /**
+     * @brief Runs every system once, in order.
+     * @param dt Delta time.
+     */
+    void update(float dt)
+    {
+        if (_systemManager.getSchedulerMode() != SchedulerMode::PARALLEL) {
+            std::apply([this, dt](auto&... stages) { ((run(stages, dt), _systemManager.sync()), ...); }, _stages);
+            return;
+        }
+
+        std::array<size_t, COUNT> level{};
+        size_t levels = SystemManager::assignBatchLevels(_access.data(), COUNT, level.data());
+        std::array<size_t, COUNT> batch{};
+        for (size_t current = 0; current < levels; ++current) {
+            size_t count = 0;
+            for (size_t index = 0; index < COUNT; ++index) {
+                if (level[index] == current)
+                    batch[count++] = index;
+            }
+            _systemManager.runParallel(batch.data(), count, [this, &batch, dt](size_t i) {
+                RUNNERS[batch[i]](*this, dt);
+            });
+            _systemManager.sync();
+        }
+    }
+
+    /**
+     * @brief Returns one of the systems.
+     */
+    template <class S>
+    S& get()
+    {
+        return std::get<Stage<S>>(_stages).system;
+    }
+
+    /**
+     * @brief Calls onCreate() on all systems.
+     */
+    void onCreateAll()
+    {
+        std::apply([](auto&... stages) { (stages.system.onCreate(), ...); }, _stages);
+    }
+
+    /**
+     * @brief Calls onDestroy() on all systems.
+     */
+    void onDestroyAll()
+    {
+        std::apply([](auto&... stages) { (stages.system.onDestroy(), ...); }, _stages);
+    }
+
+private:
+    static constexpr size_t COUNT = sizeof...(Systems);
+
+    template <class S, class = void>
+    struct ViewOf {
+        using type = std::nullptr_t;                /**< No declared components: nothing to resolve */
+    };
+
+    template <class List>
+    struct ListView;
+
+    template <class... Components>
+    struct ListView<ComponentList<Components...>> {
+        using type = View<Components...>;
+
+        static Signature signature()
+        {
+            Signature sig;
+            (sig.set(EntityManager::getComponentTypeId<Components>()), ...);
+            return sig;
+        }
+
+        static View<Components...> resolve(EntityManager& entities)
+        {
+            return entities.view<Components...>();
+        }
+    };
+
+    template <class S>
+    struct ViewOf<S, std::void_t<typename S::Components>> {
+        using type = typename ListView<typename S::Components>::type;
+    };
+
+    /**
+     * @brief A system and its resolved view.
+     */
+    template <class S>
+    struct Stage {
+        using SystemType = S;
+
+        template <class Tuple>
+        explicit Stage(Tuple&& args)
+            : system(std::make_from_tuple<S>(std::forward<Tuple>(args))) {}
+
+        S system;
+        std::optional<typename ViewOf<S>::type> view;   /**< Set by attach() when S declares Components */
+    };
+
+    template <class S>
+    void attach(EntityManager& entities, Stage<S>& stage)
+    {
+        _systemManager.attachSystem<S>(stage.system);
+        if constexpr (!std::is_same_v<typename ViewOf<S>::type, std::nullptr_t>) {
+            using List = ListView<typename S::Components>;
+            _systemManager.setSignature<S>(List::signature());
+            stage.view.emplace(List::resolve(entities));
+        }
+    }
+
+    /**
+     * @brief Runs one system with a qualified (non-virtual) call.
+     */
+    template <class S>
+    void run(Stage<S>& stage, float dt)
+    {
+        PROFILE_ALLOCATIONS(typeid(S).name());
+        if constexpr (requires { stage.system.S::update(dt, *stage.view); })
+            stage.system.S::update(dt, *stage.view);
+        else
+            stage.system.S::onUpdate(dt);
+    }
+
+    template <size_t I>
+    static void runAt(SystemPipeline& pipeline, float dt)
+    {
+        pipeline.run(std::get<I>(pipeline._stages), dt);
+    }
+
+    template <size_t... I>
+    static constexpr std::array<void (*)(SystemPipeline&, float), COUNT> runners(std::index_sequence<I...>)
+    {
+        return {&SystemPipeline::runAt<I>...};
+    }
+
+    /** Runs the system at a given position, for the batches of update() */
+    static constexpr std::array<void (*)(SystemPipeline&, float), COUNT> RUNNERS =
+        runners(std::index_sequence_for<Systems...>{});
+
+    SystemManager& _systemManager;                      /**< Manager the systems are attached to */
+    std::tuple<Stage<Systems>...> _stages;              /**< Systems in update order */
+    std::array<const SystemAccess*, COUNT> _access{};   /**< Declared access of each system, owned by the SystemManager */
+};
+
+#endif /* !SYSTEMPIPELINE_HPP_ */
@@ -0,0 +1,168 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** ThreadPool
+*/
+
+#ifndef THREADPOOL_HPP_
+#define THREADPOOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads with one task queue each and work stealing.
+ *
+ * A task submitted from a worker goes to that worker's own queue, other
+ * submissions are spread round-robin. A worker pops its own queue from the
+ * back (most recent first) and, when it is empty, steals from the front of
+ * the other queues. Threads waiting on tasks can help with runPending().
+ */
+class ThreadPool {
+public:
+    static constexpr std::size_t NPOS = std::numeric_limits<std::size_t>::max(); /**< Not a worker thread */
+
+    /**
+     * @brief Starts the workers.
+     * @param threads Number of worker threads (at least one is started).
+     */
+    explicit ThreadPool(std::size_t threads)
+    {
+        if (threads == 0)
+            threads = 1;
+        for (std::size_t i = 0; i < threads; ++i)
+            _queues.push_back(std::make_unique<Queue>());
+        for (std::size_t i = 0; i < threads; ++i)
+            _workers.emplace_back([this, i]() { workerLoop(i); });
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Runs the remaining tasks, then joins the workers.
+     */
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _stopping = true;
+        }
+        _wake.notify_all();
+        for (std::thread& worker : _workers)
+            worker.join();
+    }
+
+    /** @return Number of worker threads */
+    std::size_t size() const noexcept { return _workers.size(); }
+
+    /**
+     * @brief Queues a task.
+     * @param task Callable run once by any worker (or by a thread calling runPending()).
+     */
+    void submit(std::function<void()> task)
+    {
+        std::size_t target = _workerIndex;
+        if (target >= _queues.size() || _owner != this)
+            target = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            ++_pending;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_queues[target]->mutex);
+            _queues[target]->tasks.push_back(std::move(task));
+        }
+        _wake.notify_one();
+    }
+
+    /**
+     * @brief Runs one queued task on the calling thread, if any.
+     * @return True if a task was run.
+     */
+    bool runPending()
+    {
+        std::function<void()> task;
+        if (!tryPop(_owner == this ? _workerIndex : NPOS, task))
+            return false;
+        task();
+        return true;
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    /**
+     * @brief Takes a task from the own queue (back), else steals one from another queue (front).
+     */
+    bool tryPop(std::size_t own, std::function<void()>& task)
+    {
+        if (own < _queues.size()) {
+            Queue& queue = *_queues[own];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                --_pending;
+                return true;
+            }
+        }
+        for (std::size_t offset = 1; offset <= _queues.size(); ++offset) {
+            std::size_t victim = (own == NPOS ? 0 : own) + offset;
+            Queue& queue = *_queues[victim % _queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                --_pending;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(std::size_t index)
+    {
+        _owner = this;
+        _workerIndex = index;
+
+        for (;;) {
+            std::function<void()> task;
+            if (tryPop(index, task)) {
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _wake.wait(lock, [this]() { return _stopping || _pending > 0; });
+            if (_stopping && _pending == 0)
+                return;
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<Queue>> _queues;        /**< One task queue per worker */
+    std::vector<std::thread> _workers;                  /**< Worker threads */
+    std::atomic<std::size_t> _nextQueue{0};             /**< Round-robin target of outside submissions */
+    std::atomic<std::size_t> _pending{0};               /**< Tasks queued and not yet taken */
+    std::mutex _sleepMutex;                             /**< Guards sleeping and stopping */
+    std::condition_variable _wake;                      /**< Signaled on submission and on stop */
+    bool _stopping = false;                             /**< Set by the destructor */
+
+    inline static thread_local const ThreadPool* _owner = nullptr;   /**< Pool owning the current thread */
+    inline static thread_local std::size_t _workerIndex = NPOS;      /**< Queue of the current worker thread */
+};
+
+#endif /* !THREADPOOL_HPP_ */
@@ -1,26 +1,375 @@
-#pragma once
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** Collision
+*/
 
-#include <engine/core/Transform.hpp>
+#ifndef COLLISION_HPP_
+#define COLLISION_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define RTYPE_COLLISION_SSE2 1
+#endif
 
 namespace engine {
 namespace physics {
 
+/**
+ * @brief Axis-aligned box, from its top-left corner.
+ */
 struct AABB {
     float x, y;
     float width, height;
 };
 
+/**
+ * @brief Circle, from its center.
+ */
 struct Circle {
     float x, y;
     float radius;
 };
 
+/**
+ * @brief Shape of a collider.
+ */
+enum class Shape : std::uint8_t {
+    AABB,
+    CIRCLE
+};
+
+/**
+ * @class ColliderStore
+ * @brief Structure-of-arrays store of world-space colliders, refilled every tick.
+ *
+ * Every collider keeps its bounding box in four parallel arrays (the only
+ * data the batch test reads), its shape, its circle when it is one, an
+ * owner ID (usually the entity) and a collision layer (see LayerMatrix).
+ * Boxes and circles with no area are not stored: add() returns false and
+ * they never collide.
+ *
+ * A collider given a motion (move()) is where it ended the tick, and its
+ * bounding box covers its whole path, so the broad phase finds what it
+ * crossed; Collision::check() then sweeps it.
+ */
+class ColliderStore {
+public:
+    /**
+     * @brief Forgets every collider, keeping the storage.
+     */
+    void clear()
+    {
+        minX.clear();
+        minY.clear();
+        maxX.clear();
+        maxY.clear();
+        centerX.clear();
+        centerY.clear();
+        radius.clear();
+        shape.clear();
+        owner.clear();
+        layer.clear();
+        moveX.clear();
+        moveY.clear();
+    }
+
+    /**
+     * @brief Adds a box collider.
+     * @return false if the box is empty.
+     */
+    bool add(std::uint32_t id, const AABB& box, std::uint8_t collisionLayer = 0)
+    {
+        if (box.width <= 0.f || box.height <= 0.f)
+            return false;
+        push(id, collisionLayer, Shape::AABB, box.x, box.y, box.x + box.width, box.y + box.height, 0.f, 0.f, 0.f);
+        return true;
+    }
+
+    /**
+     * @brief Adds a circle collider.
+     * @return false if the radius is not positive.
+     */
+    bool add(std::uint32_t id, const Circle& circle, std::uint8_t collisionLayer = 0)
+    {
+        if (circle.radius <= 0.f)
+            return false;
+        push(id, collisionLayer, Shape::CIRCLE, circle.x - circle.radius, circle.y - circle.radius,
+            circle.x + circle.radius, circle.y + circle.radius, circle.x, circle.y, circle.radius);
+        return true;
+    }
+
+    /**
+     * @brief Records that a collider moved by (dx, dy) during the tick to reach its shape.
+     *
+     * Its bounding box grows to cover the path from where it started.
+     */
+    void move(std::size_t i, float dx, float dy)
+    {
+        minX[i] -= std::max(dx, 0.f);
+        maxX[i] -= std::min(dx, 0.f);
+        minY[i] -= std::max(dy, 0.f);
+        maxY[i] -= std::min(dy, 0.f);
+        moveX[i] = dx;
+        moveY[i] = dy;
+    }
+
+    /** @return Number of colliders */
+    std::size_t size() const { return owner.size(); }
+
+    /** @return True if a collider was given a motion */
+    bool moving(std::size_t i) const { return moveX[i] != 0.f || moveY[i] != 0.f; }
+
+    /** @return The bounding box of a collider at the end of the tick (the collider itself for an AABB) */
+    AABB box(std::size_t i) const
+    {
+        return {minX[i] + std::max(moveX[i], 0.f), minY[i] + std::max(moveY[i], 0.f),
+            maxX[i] - minX[i] - std::abs(moveX[i]), maxY[i] - minY[i] - std::abs(moveY[i])};
+    }
+
+    /** @return The circle of a CIRCLE collider */
+    Circle circle(std::size_t i) const { return {centerX[i], centerY[i], radius[i]}; }
+
+    std::vector<float> minX, minY, maxX, maxY;      /**< Bounding boxes */
+    std::vector<float> centerX, centerY, radius;    /**< Circles (0 for boxes) */
+    std::vector<Shape> shape;                       /**< Shape of each collider */
+    std::vector<std::uint32_t> owner;               /**< ID given to add() */
+    std::vector<std::uint8_t> layer;                /**< Collision layer given to add() */
+    std::vector<float> moveX, moveY;                /**< Motion over the tick (0 if it did not move) */
+
+private:
+    void push(std::uint32_t id, std::uint8_t collisionLayer, Shape kind,
+        float left, float top, float right, float bottom, float cx, float cy, float r)
+    {
+        minX.push_back(left);
+        minY.push_back(top);
+        maxX.push_back(right);
+        maxY.push_back(bottom);
+        centerX.push_back(cx);
+        centerY.push_back(cy);
+        radius.push_back(r);
+        shape.push_back(kind);
+        owner.push_back(id);
+        layer.push_back(collisionLayer);
+        moveX.push_back(0.f);
+        moveY.push_back(0.f);
+    }
+};
+
+/**
+ * @class Collision
+ * @brief Exact overlap tests. Touching edges do not overlap.
+ */
 class Collision {
 public:
-    static bool checkAABB(const AABB& a, const AABB& b);
-    static bool checkCircle(const Circle& a, const Circle& b);
-    static bool checkAABBCircle(const AABB& box, const Circle& circle);
+    static bool checkAABB(const AABB& a, const AABB& b)
+    {
+        return a.x < b.x + b.width && b.x < a.x + a.width
+            && a.y < b.y + b.height && b.y < a.y + a.height;
+    }
+
+    static bool checkCircle(const Circle& a, const Circle& b)
+    {
+        float dx = a.x - b.x;
+        float dy = a.y - b.y;
+        float r = a.radius + b.radius;
+        return dx * dx + dy * dy < r * r;
+    }
+
+    static bool checkAABBCircle(const AABB& box, const Circle& circle)
+    {
+        // Distance from the center to the closest point of the box
+        float dx = circle.x - std::clamp(circle.x, box.x, box.x + box.width);
+        float dy = circle.y - std::clamp(circle.y, box.y, box.y + box.height);
+        return dx * dx + dy * dy < circle.radius * circle.radius;
+    }
+
+    /**
+     * @brief Time of impact of a box moving by (dx, dy) against a box that does not move.
+     * @param time Receives when, from 0 (start of the motion) to 1 (end), they start overlapping.
+     * @return True if they overlap at some point of the motion.
+     */
+    static bool sweepAABB(const AABB& a, const AABB& b, float dx, float dy, float& time)
+    {
+        float enter = 0.f;
+        float exit = 1.f;
+        if (!sweepAxis(a.x, a.x + a.width, b.x, b.x + b.width, dx, enter, exit)
+            || !sweepAxis(a.y, a.y + a.height, b.y, b.y + b.height, dy, enter, exit))
+            return false;
+        time = enter;
+        return true;
+    }
+
+    /**
+     * @brief Time of impact of a circle moving by (dx, dy) against a circle that does not move.
+     * @param time Receives when, from 0 (start of the motion) to 1 (end), they start overlapping.
+     * @return True if they overlap at some point of the motion.
+     */
+    static bool sweepCircle(const Circle& a, const Circle& b, float dx, float dy, float& time)
+    {
+        // Smallest t with |s + t * d| < r, s being the gap between the centers
+        float sx = a.x - b.x;
+        float sy = a.y - b.y;
+        float r = a.radius + b.radius;
+        float c = sx * sx + sy * sy - r * r;
+        if (c < 0.f) {
+            time = 0.f;
+            return true;
+        }
+        float qa = dx * dx + dy * dy;
+        float qb = sx * dx + sy * dy;
+        float discriminant = qb * qb - qa * c;
+        if (qa == 0.f || qb >= 0.f || discriminant <= 0.f)
+            return false;
+        time = (-qb - std::sqrt(discriminant)) / qa;
+        return time < 1.f;
+    }
+
+    /**
+     * @brief Exact test between two colliders of a store, whatever their shapes and motions.
+     *
+     * Colliders without a motion are tested where they are. Otherwise both
+     * are swept from where they started: circles against circles exactly,
+     * anything else by bounding boxes (a circle's corners overlap a little
+     * early).
+     *
+     * @param time If not null, receives when in the tick (0 to 1) they start
+     *   overlapping; 0 if neither moved.
+     */
+    static bool check(const ColliderStore& store, std::size_t a, std::size_t b, float* time = nullptr)
+    {
+        if (store.moving(a) || store.moving(b))
+            return sweep(store, a, b, time);
+        if (time)
+            *time = 0.f;
+        Shape sa = store.shape[a];
+        Shape sb = store.shape[b];
+        if (sa == Shape::AABB && sb == Shape::AABB)
+            return checkAABB(store.box(a), store.box(b));
+        if (sa == Shape::CIRCLE && sb == Shape::CIRCLE)
+            return checkCircle(store.circle(a), store.circle(b));
+        if (sa == Shape::AABB)
+            return checkAABBCircle(store.box(a), store.circle(b));
+        return checkAABBCircle(store.box(b), store.circle(a));
+    }
+
+    /**
+     * @brief Tests a batch of candidate pairs of a store.
+     *
+     * The bounding boxes are compared four pairs at a time with SSE2 (a
+     * scalar loop elsewhere); only the pairs whose boxes overlap and that
+     * involve a circle or a moving collider go through the exact scalar
+     * test.
+     *
+     * @param store Colliders.
+     * @param first First collider of each pair.
+     * @param second Second collider of each pair.
+     * @param count Number of pairs.
+     * @param hits Receives 1 for each overlapping pair, 0 otherwise.
+     * @param times If not null, receives when in the tick (0 to 1) each
+     *   overlapping pair starts overlapping (see check()).
+     */
+    static void checkPairs(const ColliderStore& store, const std::uint32_t* first,
+        const std::uint32_t* second, std::size_t count, std::uint8_t* hits, float* times = nullptr)
+    {
+        std::size_t k = 0;
+#ifdef RTYPE_COLLISION_SSE2
+        const float* minX = store.minX.data();
+        const float* minY = store.minY.data();
+        const float* maxX = store.maxX.data();
+        const float* maxY = store.maxY.data();
+        for (; k + 4 <= count; k += 4) {
+            const std::uint32_t* a = first + k;
+            const std::uint32_t* b = second + k;
+            __m128 overlap = _mm_and_ps(
+                _mm_and_ps(
+                    _mm_cmplt_ps(gather(minX, a), gather(maxX, b)),
+                    _mm_cmplt_ps(gather(minX, b), gather(maxX, a))),
+                _mm_and_ps(
+                    _mm_cmplt_ps(gather(minY, a), gather(maxY, b)),
+                    _mm_cmplt_ps(gather(minY, b), gather(maxY, a))));
+            int mask = _mm_movemask_ps(overlap);
+            for (int lane = 0; lane < 4; ++lane)
+                hits[k + lane] = static_cast<std::uint8_t>((mask >> lane) & 1);
+        }
+#endif
+        for (; k < count; ++k)
+            hits[k] = boxesOverlap(store, first[k], second[k]);
+        for (k = 0; k < count; ++k) {
+            std::uint32_t a = first[k];
+            std::uint32_t b = second[k];
+            if (times)
+                times[k] = 0.f;
+            if (hits[k] && (store.shape[a] != Shape::AABB || store.shape[b] != Shape::AABB
+                    || store.moving(a) || store.moving(b)))
+                hits[k] = check(store, a, b, times ? times + k : nullptr);
+        }
+    }
+
+private:
+    /**
+     * @brief Narrows [enter, exit] to the times the intervals overlap on one axis.
+     * @return False if that leaves no time at all.
+     */
+    static bool sweepAxis(float aMin, float aMax, float bMin, float bMax, float d, float& enter, float& exit)
+    {
+        if (d == 0.f)
+            return aMin < bMax && bMin < aMax;
+        float t0 = (bMin - aMax) / d;
+        float t1 = (bMax - aMin) / d;
+        if (d < 0.f)
+            std::swap(t0, t1);
+        enter = std::max(enter, t0);
+        exit = std::min(exit, t1);
+        return enter < exit;
+    }
+
+    static bool sweep(const ColliderStore& store, std::size_t a, std::size_t b, float* time)
+    {
+        // b stays where it started, a moves by the difference of their motions
+        float dx = store.moveX[a] - store.moveX[b];
+        float dy = store.moveY[a] - store.moveY[b];
+        float impact = 0.f;
+        bool hit;
+        if (store.shape[a] == Shape::CIRCLE && store.shape[b] == Shape::CIRCLE) {
+            Circle ca = store.circle(a);
+            Circle cb = store.circle(b);
+            hit = sweepCircle({ca.x - store.moveX[a], ca.y - store.moveY[a], ca.radius},
+                {cb.x - store.moveX[b], cb.y - store.moveY[b], cb.radius}, dx, dy, impact);
+        } else {
+            AABB ba = store.box(a);
+            AABB bb = store.box(b);
+            hit = sweepAABB({ba.x - store.moveX[a], ba.y - store.moveY[a], ba.width, ba.height},
+                {bb.x - store.moveX[b], bb.y - store.moveY[b], bb.width, bb.height}, dx, dy, impact);
+        }
+        if (hit && time)
+            *time = impact;
+        return hit;
+    }
+
+    static std::uint8_t boxesOverlap(const ColliderStore& store, std::uint32_t a, std::uint32_t b)
+    {
+        return store.minX[a] < store.maxX[b] && store.minX[b] < store.maxX[a]
+            && store.minY[a] < store.maxY[b] && store.minY[b] < store.maxY[a];
+    }
+
+#ifdef RTYPE_COLLISION_SSE2
+    static __m128 gather(const float* values, const std::uint32_t* index)
+    {
+        return _mm_setr_ps(values[index[0]], values[index[1]], values[index[2]], values[index[3]]);
+    }
+#endif
 };
 
 } // namespace physics
 } // namespace engine
+
+#endif /* !COLLISION_HPP_ */
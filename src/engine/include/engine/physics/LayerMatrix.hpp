@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** LayerMatrix
+*/
+
+#ifndef LAYERMATRIX_HPP_
+#define LAYERMATRIX_HPP_
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+namespace engine {
+namespace physics {
+
+/**
+ * @class LayerMatrix
+ * @brief Symmetric table of the collision layers that interact.
+ *
+ * Every collider gets a layer (0 to LAYERS - 1) and the matrix tells, for
+ * each pair of layers, whether their colliders need testing at all. It is
+ * filled once; SpatialGrid then drops the boxes of layers interacting with
+ * nothing and the pairs of layers that never interact.
+ */
+class LayerMatrix {
+public:
+    static constexpr std::size_t LAYERS = 128;     /**< Number of layers */
+
+    /**
+     * @brief Makes two layers interact, or not (both orders).
+     */
+    void set(std::uint8_t a, std::uint8_t b, bool interacts = true)
+    {
+        _rows[a].set(b, interacts);
+        _rows[b].set(a, interacts);
+    }
+
+    /** @return True if colliders of these layers need testing */
+    bool test(std::uint8_t a, std::uint8_t b) const { return _rows[a].test(b); }
+
+    /** @return True if colliders of this layer interact with some layer */
+    bool any(std::uint8_t layer) const { return _rows[layer].any(); }
+
+private:
+    std::array<std::bitset<LAYERS>, LAYERS> _rows{};   /**< Interacting layers of each layer */
+};
+
+} // namespace physics
+} // namespace engine
+
+#endif /* !LAYERMATRIX_HPP_ */
@@ -0,0 +1,181 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** SpatialGrid
+*/
+
+#ifndef SPATIALGRID_HPP_
+#define SPATIALGRID_HPP_
+
+#include <engine/physics/LayerMatrix.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace engine {
+namespace physics {
+
+/**
+ * @class SpatialGrid
+ * @brief Uniform-grid broad phase: finds the pairs of boxes that share a cell.
+ *
+ * The grid covers a fixed field (e.g. the 1920x1080 play field) cut into
+ * square cells; boxes outside of it are clamped into the border cells, so
+ * they still meet their neighbours. The grid is rebuilt every tick:
+ *
+ * @code
+ * grid.clear();
+ * for (std::uint32_t i = 0; i < boxes.size(); ++i)
+ *     grid.insert(i, boxes[i].left, boxes[i].top, boxes[i].right, boxes[i].bottom);
+ * grid.build();
+ * grid.forEachPair([&](std::uint32_t a, std::uint32_t b) { narrowPhase(a, b); });
+ * @endcode
+ *
+ * Each candidate pair is reported once, with a < b, even when the boxes
+ * share several cells. Candidates only share a cell: the caller still runs
+ * its exact overlap test. The storage is kept between ticks, so rebuilding
+ * does not allocate once the grid has seen its largest population.
+ *
+ * With a LayerMatrix (setLayerMatrix()), each box carries a layer: boxes of
+ * a layer interacting with nothing are not stored, and pairs of layers that
+ * never interact are not reported.
+ */
+class SpatialGrid {
+public:
+    /**
+     * @param width Field width.
+     * @param height Field height.
+     * @param cellSize Side of a cell; about the size of the largest common box.
+     */
+    SpatialGrid(float width, float height, float cellSize)
+        : _cellSize(cellSize),
+          _columns(std::max<std::int32_t>(1, static_cast<std::int32_t>(width / cellSize + 0.999f))),
+          _rows(std::max<std::int32_t>(1, static_cast<std::int32_t>(height / cellSize + 0.999f))),
+          _cellStart(static_cast<std::size_t>(_columns) * _rows + 1, 0) {}
+
+    /**
+     * @brief Filters the boxes and pairs by layer from now on.
+     * @param layers Matrix outliving the grid, or nullptr to report every pair.
+     */
+    void setLayerMatrix(const LayerMatrix* layers)
+    {
+        _layers = layers;
+    }
+
+    /**
+     * @brief Forgets every box.
+     */
+    void clear()
+    {
+        _boxes.clear();
+    }
+
+    /**
+     * @brief Adds a box; call build() once every box is inserted.
+     * @param id Identifier reported by forEachPair() (usually an index into the caller's array).
+     * @param layer Layer of the box, only read with a LayerMatrix.
+     */
+    void insert(std::uint32_t id, float left, float top, float right, float bottom, std::uint8_t layer = 0)
+    {
+        if (_layers && !_layers->any(layer))
+            return;
+        _boxes.push_back({id, column(left), row(top), column(right), row(bottom), layer});
+    }
+
+    /**
+     * @brief Sorts the inserted boxes into their cells.
+     */
+    void build()
+    {
+        std::fill(_cellStart.begin(), _cellStart.end(), 0);
+        for (const Box& box : _boxes)
+            forEachCell(box, [this](std::size_t cell) { ++_cellStart[cell + 1]; });
+        for (std::size_t cell = 1; cell < _cellStart.size(); ++cell)
+            _cellStart[cell] += _cellStart[cell - 1];
+
+        _cellItems.resize(_cellStart.back());
+        _cursor.assign(_cellStart.begin(), _cellStart.end() - 1);
+        for (std::uint32_t index = 0; index < _boxes.size(); ++index)
+            forEachCell(_boxes[index], [this, index](std::size_t cell) { _cellItems[_cursor[cell]++] = index; });
+    }
+
+    /**
+     * @brief Calls fn(a, b) once for every pair of boxes sharing at least one cell
+     *        (and whose layers interact, with a LayerMatrix).
+     * @param fn Callable taking the two box IDs, the smaller first.
+     */
+    template <class Fn>
+    void forEachPair(Fn&& fn) const
+    {
+        for (std::int32_t y = 0; y < _rows; ++y) {
+            for (std::int32_t x = 0; x < _columns; ++x) {
+                std::size_t cell = static_cast<std::size_t>(y) * _columns + x;
+                std::uint32_t begin = _cellStart[cell];
+                std::uint32_t end = _cellStart[cell + 1];
+                for (std::uint32_t i = begin; i < end; ++i) {
+                    const Box& a = _boxes[_cellItems[i]];
+                    for (std::uint32_t j = i + 1; j < end; ++j) {
+                        const Box& b = _boxes[_cellItems[j]];
+                        if (_layers && !_layers->test(a.layer, b.layer))
+                            continue;
+                        // Report the pair only in the first cell both boxes cover
+                        if (std::max(a.x0, b.x0) != x || std::max(a.y0, b.y0) != y)
+                            continue;
+                        if (a.id < b.id)
+                            fn(a.id, b.id);
+                        else
+                            fn(b.id, a.id);
+                    }
+                }
+            }
+        }
+    }
+
+    /** @return Number of boxes stored since the last clear() */
+    std::size_t size() const { return _boxes.size(); }
+
+    /** @return Number of cells */
+    std::size_t cellCount() const { return _cellStart.size() - 1; }
+
+private:
+    struct Box {
+        std::uint32_t id;
+        std::int32_t x0, y0, x1, y1;    /**< Covered cells, inclusive and clamped to the grid */
+        std::uint8_t layer;
+    };
+
+    std::int32_t column(float x) const
+    {
+        return std::clamp(static_cast<std::int32_t>(x / _cellSize), 0, _columns - 1);
+    }
+
+    std::int32_t row(float y) const
+    {
+        return std::clamp(static_cast<std::int32_t>(y / _cellSize), 0, _rows - 1);
+    }
+
+    template <class Fn>
+    void forEachCell(const Box& box, Fn&& fn) const
+    {
+        for (std::int32_t y = box.y0; y <= box.y1; ++y)
+            for (std::int32_t x = box.x0; x <= box.x1; ++x)
+                fn(static_cast<std::size_t>(y) * _columns + x);
+    }
+
+    float _cellSize;
+    std::int32_t _columns;
+    std::int32_t _rows;
+    const LayerMatrix* _layers = nullptr;       /**< Layer filter, if any */
+    std::vector<Box> _boxes;                    /**< Inserted boxes, in insertion order */
+    std::vector<std::uint32_t> _cellStart;      /**< Offset of each cell in _cellItems, plus the end */
+    std::vector<std::uint32_t> _cellItems;      /**< Indices into _boxes, grouped by cell */
+    std::vector<std::uint32_t> _cursor;         /**< Fill position per cell while building */
+};
+
+} // namespace physics
+} // namespace engine
+
+#endif /* !SPATIALGRID_HPP_ */
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** AllocationHook
+*/
+
+// Replacement of the global allocation functions feeding AllocationProfiler.
+// Only compiled in with -DRTYPE_ALLOC_PROFILER=ON: it adds a thread-local
+// increment to every operator new of the process.
+
+#ifdef RTYPE_ALLOC_PROFILER
+
+#include <engine/core/AllocationProfiler.hpp>
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+void* allocateCounted(std::size_t size)
+{
+    AllocationProfiler::recordAllocation(size);
+    if (size == 0)
+        size = 1;
+    while (true) {
+        if (void* block = std::malloc(size))
+            return block;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* allocateCounted(std::size_t size, std::align_val_t alignment)
+{
+    AllocationProfiler::recordAllocation(size);
+    std::size_t align = static_cast<std::size_t>(alignment);
+    // aligned_alloc wants a size multiple of the alignment
+    std::size_t rounded = (size + align - 1) / align * align;
+    if (rounded == 0)
+        rounded = align;
+    while (true) {
+        if (void* block = std::aligned_alloc(align, rounded))
+            return block;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return allocateCounted(size); }
+void* operator new[](std::size_t size) { return allocateCounted(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocateCounted(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocateCounted(size, alignment); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return allocateCounted(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return allocateCounted(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete[](void* block) noexcept { std::free(block); }
+void operator delete(void* block, std::size_t) noexcept { std::free(block); }
+void operator delete[](void* block, std::size_t) noexcept { std::free(block); }
+void operator delete(void* block, std::align_val_t) noexcept { std::free(block); }
+void operator delete[](void* block, std::align_val_t) noexcept { std::free(block); }
+void operator delete(void* block, std::size_t, std::align_val_t) noexcept { std::free(block); }
+void operator delete[](void* block, std::size_t, std::align_val_t) noexcept { std::free(block); }
+void operator delete(void* block, const std::nothrow_t&) noexcept { std::free(block); }
+void operator delete[](void* block, const std::nothrow_t&) noexcept { std::free(block); }
+
+#endif /* RTYPE_ALLOC_PROFILER */
@@ -91,6 +91,10 @@ class Game {
         std::deque<common::network::ReceivedPacket> _incoming;
         std::deque<std::pair<common::protocol::Packet, std::optional<uint32_t>>> _outgoing;
 
+        // Packets handled during the current tick, reused by every tick
+        std::vector<common::protocol::Packet> _tickIncomingPackets;
+        std::vector<common::protocol::Packet> _tickOutgoingPackets;
+
         // Mutexes to protect queue access across threads
         std::mutex _incomingMutex;
         std::mutex _outgoingMutex;
@@ -12,6 +12,7 @@
 #include <string>
 #include <functional>
 #include <deque>
+#include <span>
 
 #include <engine/GameEngine.hpp>
 #include <engine/ecs/component/Components.hpp>
@@ -33,6 +34,11 @@
 #include <game/systems/AccessibilitySystem.hpp>
 #include <game/systems/BackgroundSystem.hpp>
 #include <game/systems/RebindSystem.hpp>
+#include <game/systems/LevelSystem.hpp>
+#include <game/systems/CollisionSystem.hpp>
+#include <game/systems/DamageSystem.hpp>
+#include <game/systems/ScoreSystem.hpp>
+#include <game/systems/DestroySystem.hpp>
 
 
 class Coordinator {
@@ -45,6 +51,18 @@ class Coordinator {
             float velY;
         };
 
+        /** @brief Prefabs compiled by registerPrefabs() */
+        enum class PrefabId : uint8_t {
+            PLAYER,
+            ENEMY_BASIC,
+            ENEMY_FAST,
+            ENEMY_TANK,
+            ENEMY_BOSS,
+            PROJECTILE,
+            PROJECTILE_BASIC,
+            PROJECTILE_CHARGED
+        };
+
         Coordinator() : _isServer(false) {
             std::cout << "Coordinator constructor START" << std::endl;
             std::cout << "Coordinator constructor END" << std::endl;
@@ -57,6 +75,13 @@ class Coordinator {
 
         void initEngine();
         void initEngineRender();
+
+        /**
+         * @brief Returns the prefab an enemy of the given type is spawned from.
+         * @param type The enemy type (unknown types fall back to BASIC).
+         * @return The prefab, holding the default Velocity, Health, Weapon and AI of the type.
+         */
+        const Prefab& getEnemyPrefab(EnemyType type) const;
         
         /** @brief Sets whether this coordinator is running on the server. */
         void setIsServer(bool isServer) { _isServer = isServer; }
@@ -242,6 +267,16 @@ class Coordinator {
         /** @brief Get the GameEngine instance for direct access. */
         std::shared_ptr<gameEngine::GameEngine> getEngine() { return _engine; }
 
+        /** @brief Gameplay systems of the server, in update order. */
+        using ServerPipeline = SystemPipeline<PlayerSystem, ShootSystem, LevelSystem,
+            MovementSystem, CollisionSystem, DamageSystem, ScoreSystem, DestroySystem>;
+
+        /**
+         * @brief Runs one tick of systems: the SystemManager ones, then the server pipeline (server-side).
+         * @param dt Delta time in seconds.
+         */
+        void updateSystems(float dt);
+
         /** @brief Create and initialize a level entity (server-side only).
          * @param levelNumber The level number (used for naming).
          * @param duration Level duration in seconds (0 = infinite/until all waves complete).
@@ -286,9 +321,9 @@ class Coordinator {
         // CREATE PACKET
 
         bool createPacketEntitySpawn(common::protocol::Packet* packet, uint32_t entityId, uint32_t sequence_number);
-        bool createPacketTransformSnapshot(common::protocol::Packet* packet, const std::vector<uint32_t>& entityIds, uint32_t sequence_number);
-        bool createPacketHealthSnapshot(common::protocol::Packet* packet, const std::vector<uint32_t>& entityIds, uint32_t sequence_number);
-        bool createPacketWeaponSnapshot(common::protocol::Packet* packet, const std::vector<uint32_t>& entityIds, uint32_t sequence_number);
+        bool createPacketTransformSnapshot(common::protocol::Packet* packet, std::span<const uint32_t> entityIds, uint32_t sequence_number);
+        bool createPacketHealthSnapshot(common::protocol::Packet* packet, std::span<const uint32_t> entityIds, uint32_t sequence_number);
+        bool createPacketWeaponSnapshot(common::protocol::Packet* packet, std::span<const uint32_t> entityIds, uint32_t sequence_number);
 
         /**
          * @brief Creates an ENTITY_DESTROY packet
@@ -325,6 +360,11 @@ class Coordinator {
         std::deque<PlayerReadyEvent> _pendingPlayerReadyEvents;
 
     private:
+        /**
+         * @brief Builds the prefab of every entity kind spawned by the game (called once by initEngine).
+         */
+        void registerPrefabs();
+
         void setupPlayerEntity(
             Entity entity,
             uint32_t playerId,
@@ -430,7 +470,13 @@ class Coordinator {
     private:
         PlayerSpriteAllocator _playerSpriteAllocator;
 
+        // Component bundles of players, enemies and projectiles, built once at startup
+        PrefabRegistry<PrefabId> _prefabs;
+
         std::shared_ptr<gameEngine::GameEngine> _engine;
+
+        // Server gameplay systems; declared after _engine, so released before it
+        std::shared_ptr<ServerPipeline> _serverSystems;
         
         // Server/Client flag
         bool _isServer;
@@ -444,6 +490,17 @@ class Coordinator {
         // Track entities that have been broadcast to clients (server-side only)
         // Used to send initial ENTITY_SPAWN packets for newly created networked entities
         std::set<uint32_t> _broadcastedEntityIds;
+
+        // Entities that gained a NetworkId since the last server tick (server-side only)
+        // Filled by the onAdd<NetworkId> observer, drained by buildServerPacketBasedOnStatus()
+        std::vector<Entity> _pendingSpawnBroadcasts;
+
+        // Argument buffer of the packets built every tick, reused to keep its capacity
+        std::vector<uint8_t> _packetArgs;
+
+        // Change tick of the previous server snapshot (server-side only)
+        // Health and Weapon snapshots only carry the components written after it
+        uint32_t _lastSnapshotTick = 0;
 };
 
 #endif /* !COORDINATOR_HPP_ */
@@ -10,40 +10,119 @@
 
 #include <engine/GameEngine.hpp>
 #include <engine/ecs/system/System.hpp>
+#include <engine/physics/Collision.hpp>
+#include <engine/physics/LayerMatrix.hpp>
+#include <engine/physics/SpatialGrid.hpp>
+#include <common/constants/defines.hpp>
 
-struct Transform;
-struct Sprite;
-struct Team;
+#include <engine/ecs/component/Components.hpp>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
 
 /**
  * @class CollisionSystem
- * @brief Handles collision detection and team-based damage resolution.
+ * @brief Finds the collisions of the tick and records them as CollisionEvents.
  *
  * This system:
- * - Detects AABB collisions between entities with HitBox and Sprite
- * - Applies damage based on Team components
- * - Destroys projectiles on impact
- * - Respects team collision rules (e.g., player bullets don't hit players)
- * - Prevents obstacles from taking damage
+ * - Places the HitBox shape (box or circle) of every entity with a
+ *   Transform into a collider store (engine::physics::ColliderStore),
+ *   on the collision layer of its Team and Projectile (layerOf());
+ *   only a HitBox sized from its Sprite reads the Sprite
+ * - Sweeps every Projectile with a Velocity along its `vel * dt` motion of
+ *   the tick (MovementSystem runs first), so a fast or low-tick-rate
+ *   projectile still hits a target thinner than its step
+ * - Keeps the pairs sharing a cell of a uniform grid over the play field
+ *   (engine::physics::SpatialGrid) whose layers can interact, and tests
+ *   them in one batch (engine::physics::Collision::checkPairs)
+ * - Turns each overlapping pair into at most one CollisionEvent (classify())
+ *   appended to the CollisionEvents resource, which it clears first, and
+ *   orders them by time of impact
+ *
+ * It writes nothing else: DamageSystem, ScoreSystem, DestroySystem and the
+ * server's packet builder react to the events.
  *
  * Team Rules:
- * - Player projectiles only damage ENEMY or BOSS
- * - Enemy projectiles only damage PLAYER
- * - OBSTACLE entities never take damage
- * - Non-projectile collisions are processed based on team compatibility
+ * - Player projectiles only hit ENEMY or BOSS, enemy projectiles only PLAYER
+ *   (Team::canCollide()); a projectile never hits its shooter
+ * - Projectiles never hit each other
+ * - OBSTACLE entities never take part in a gameplay collision
+ * - A player touching an ENEMY or BOSS is a CONTACT
+ *
+ * These rules only read team masks, so they are computed once for every
+ * pair of layers (ruleOf()); the pass then only looks them up, and the
+ * grid never pairs, say, two player projectiles or a player projectile
+ * and a player.
  */
 class CollisionSystem : public System{
     public:
-        CollisionSystem(gameEngine::GameEngine& engine) : _engine(engine) {}
+        CollisionSystem(gameEngine::GameEngine& engine) : _engine(engine)
+        {
+            if (!_engine.hasResource<CollisionEvents>())
+                _engine.insertResource<CollisionEvents>();
+            _grid.setLayerMatrix(&layerMatrix());
+        }
 
         void onCreate() override {}
         void onUpdate(float dt) override;
 
+        static constexpr std::uint8_t TEAM_LAYER_BITS = 0x3F;        /**< Team mask bits kept in a layer */
+        static constexpr std::uint8_t PROJECTILE_LAYER_BIT = 0x40;   /**< Set on the layer of a Projectile */
+
+        /**
+         * @brief Collision layer of an entity: its team mask, plus a bit for projectiles.
+         * @param team The entity's Team, or nullptr for NEUTRAL.
+         */
+        static std::uint8_t layerOf(const Team* team, bool isProjectile);
+
+        /**
+         * @brief Gameplay meaning of two overlapping entities; reads nothing but its arguments.
+         * @return The event, or nothing if the pair does not interact.
+         */
+        static std::optional<CollisionEvent> classify(std::uint32_t e1, std::uint8_t layer1,
+            std::uint32_t e2, std::uint8_t layer2, const ComponentManager<Projectile>& projectiles);
+
+        /** @return The layers that can interact at all, shared by every CollisionSystem */
+        static const engine::physics::LayerMatrix& layerMatrix() { return rules().matrix; }
+
     private:
+        /**
+         * @brief What a pair of layers gives when their colliders overlap.
+         */
+        struct LayerRule {
+            bool interacts = false;
+            CollisionKind kind = CollisionKind::CONTACT;
+            bool swapped = false;   /**< The event's `a` is the second collider */
+        };
+
+        struct Rules {
+            std::array<LayerRule, engine::physics::LayerMatrix::LAYERS * engine::physics::LayerMatrix::LAYERS> rules{};
+            engine::physics::LayerMatrix matrix;
+        };
+
+        /** @return The rule of every pair of layers, built on first use */
+        static const Rules& rules();
+
+        /** @brief Team rules between two layers, without the shooter check */
+        static LayerRule ruleOf(std::uint8_t layer1, std::uint8_t layer2);
+
         gameEngine::GameEngine& _engine;
+        engine::physics::SpatialGrid _grid{WINDOW_WIDTH, WINDOW_HEIGHT, COLLISION_GRID_CELL_SIZE};   /**< Broad phase, rebuilt every pass */
+        engine::physics::ColliderStore _colliders;  /**< World-space shapes, refilled every pass */
+
+        /**
+         * @brief Adds the world-space shape of an entity's HitBox to _colliders.
+         * @param sprite The entity's Sprite, or nullptr; only read by a HitBox without a size.
+         * @param sweep Velocity the collider moved with during the last dt, or nullptr not to sweep it.
+         */
+        void addCollider(size_t entity, std::uint8_t layer, const Transform& transform,
+            const HitBox& hitBox, const Sprite* sprite, const Velocity* sweep, float dt);
 
-        bool checkAABBCollision(const Sprite& s1, const Sprite& s2);
-        void updateGlobalBounds(Sprite& sprite, const Transform& transform);
+        /** @return False if the shape is empty and was not added */
+        bool placeCollider(size_t entity, std::uint8_t layer, const Transform& transform,
+            const HitBox& hitBox, const Sprite* sprite);
 };
 
 #endif /* !COLLISIONSYSTEM_HPP_ */
@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** DamageSystem
+*/
+
+#ifndef DAMAGESYSTEM_HPP_
+#define DAMAGESYSTEM_HPP_
+
+#include <engine/ecs/system/System.hpp>
+#include <engine/ecs/component/Components.hpp>
+#include <engine/GameEngine.hpp>
+
+/**
+ * @class DamageSystem
+ * @brief Resolves the CollisionEvents of the tick into HitEvents.
+ *
+ * The collisions are walked in the order CollisionSystem found them:
+ * - PROJECTILE_HIT: the projectile deals its damage to the target, then is spent
+ * - CONTACT: the player deals CONTACT_DAMAGE to the enemy
+ *
+ * A player target loses no Health (the hit costs score instead); any other
+ * target with Health loses the damage and is killed at 0. An event naming a
+ * projectile already spent or an entity already killed this tick is dropped.
+ * Each resolved event appends a HitEvent; removing the spent and killed
+ * entities is left to DestroySystem.
+ */
+class DamageSystem : public System {
+public:
+    static constexpr int32_t CONTACT_DAMAGE = 10;   /**< Damage of a player ramming an enemy */
+
+    explicit DamageSystem(gameEngine::GameEngine& engine) : _engine(engine) {}
+
+    void onCreate() override {}
+    void onUpdate(float dt) override;
+
+private:
+    /**
+     * @brief Applies one hit to a target and records its HitEvent.
+     * @return True if the target was killed.
+     */
+    bool hit(CollisionEvents& events, std::uint32_t target, std::uint32_t source, CollisionKind kind, int32_t damage);
+
+    gameEngine::GameEngine& _engine;
+    EntitySet _removed;     /**< Entities spent or killed during the current pass, kept to reuse its storage */
+};
+
+#endif /* !DAMAGESYSTEM_HPP_ */
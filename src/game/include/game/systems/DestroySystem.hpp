@@ -13,6 +13,11 @@
 #include <engine/ecs/component/Components.hpp>
 #include <engine/GameEngine.hpp>
 
+/**
+ * @class DestroySystem
+ * @brief Kills the entities far outside the play field, and strips the
+ *        projectiles spent and the targets killed by the HitEvents of the tick.
+ */
 class DestroySystem : public System {
 public:
     DestroySystem(gameEngine::GameEngine& engine)
@@ -7,6 +7,8 @@
 
 class MovementSystem : public System {
 public:
+    using Components = ComponentList<Transform, Velocity>; /**< Signature, view resolved once by a SystemPipeline */
+
     MovementSystem(gameEngine::GameEngine& engine)
         : _engine(engine)
     {}
@@ -15,6 +17,11 @@ public:
 
     void onUpdate(float dt) override;
 
+    /**
+     * @brief Integrates the velocity of every entity of the view.
+     */
+    void update(float dt, View<Transform, Velocity>& view);
+
 private:
     gameEngine::GameEngine& _engine;
 };
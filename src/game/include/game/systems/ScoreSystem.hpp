@@ -8,19 +8,31 @@
 #include <engine/ecs/component/Components.hpp>
 #include <cstdint>
 
+/**
+ * @class ScoreSystem
+ * @brief Applies the score changes of the frame to the ScoreBoard and shows the total.
+ *
+ * Reads the HitEvents of the tick (CollisionEvents resource): a player hit
+ * costs PLAYER_HIT_PENALTY, a bounty kill earns KILL_BONUS. Other changes are
+ * queued with pushEvent().
+ */
 class ScoreSystem : public System {
 public:
-    explicit ScoreSystem(gameEngine::GameEngine& e) : _engine(e) {}
+    static constexpr int32_t PLAYER_HIT_PENALTY = 10;   /**< Lost when a player is hit */
+    static constexpr int32_t KILL_BONUS = 100;          /**< Won when the players kill an enemy or a boss */
 
-    void setHudEntity(Entity e) { _hud = e; }
-    Entity getHudEntity() const { return _hud; }
-    void pushEvent(int32_t amount) { _engine.scoreEvents().push_back({amount}); }
+    explicit ScoreSystem(gameEngine::GameEngine& e) : _engine(e)
+    {
+        if (!_engine.hasResource<ScoreBoard>())
+            _engine.insertResource<ScoreBoard>();
+    }
+
+    void pushEvent(int32_t amount) { _engine.getResource<ScoreBoard>().events.push_back(amount); }
 
     void onUpdate(float) override;
 
 private:
     gameEngine::GameEngine& _engine;
-    Entity _hud = Entity::fromId(0);
 };
 
 #endif // SCORESYSTEM_HPP_
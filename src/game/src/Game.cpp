@@ -14,6 +14,9 @@
 #include <common/logger/Logger.hpp>
 #include <common/error/Error.hpp>
 #include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/core/FrameArena.hpp>
+#include <engine/core/AllocationProfiler.hpp>
+#include <fstream>
 #include <game/systems/ScoreSystem.hpp>
 
 Game::Game(Type type)
@@ -55,15 +58,11 @@ Game::Game(Type type)
             // Score and timer HUD entities will be created after LEVEL_START
         }
 
-        Entity configurationEntity = this->getCoordinator()->getEngine()->createEntity("Configuration Game Entity");
-        this->getCoordinator()->getEngine()->addComponent<GameConfig>(configurationEntity, GameConfig(FontAssets::DEFAULT_FONT, true, true));
+        GameConfig& gameConfig = this->getCoordinator()->getEngine()->insertResource<GameConfig>(FontAssets::DEFAULT_FONT, true, true);
 
         if (_type == Type::CLIENT || _type == Type::STAND_ALONE) {
-            auto& gameConfig = this->getCoordinator()->getEngine()->getComponentEntity<GameConfig>(configurationEntity);
-            if (gameConfig.has_value()) {
-                this->getCoordinator()->getEngine()->getRenderManager()->updateKeyBindings(gameConfig->_keybinds);
-                LOG_INFO("Game: Keybinds synchronized with RenderManager");
-            }
+            this->getCoordinator()->getEngine()->getRenderManager()->updateKeyBindings(gameConfig._keybinds);
+            LOG_INFO("Game: Keybinds synchronized with RenderManager");
         }
 
         // Initialize timing
@@ -99,11 +98,12 @@ void Game::hideGameEntities()
     
     // Destroy the score HUD entity
     try {
-        auto scoreSystem = engine->getSystem<ScoreSystem>();
-        Entity hudEntity = scoreSystem.getHudEntity();
-        if (hudEntity != Entity::fromId(0)) {
-            engine->destroyEntity(hudEntity);
-            LOG_DEBUG("Destroyed score HUD entity");
+        if (ScoreBoard* board = engine->tryGetResource<ScoreBoard>()) {
+            if (board->hud != Entity::fromId(0)) {
+                engine->destroyEntity(board->hud);
+                board->hud = Entity::fromId(0);
+                LOG_DEBUG("Destroyed score HUD entity");
+            }
         }
     } catch (const std::exception& e) {
         LOG_WARN("Failed to destroy score HUD entity: {}", e.what());
@@ -248,15 +248,18 @@ void Game::serverTick(uint64_t elapsedMs)
     // 5. Queue outgoing packets to clients
     // ============================================================================
     LOG_DEBUG("Server tick: elapsedMs={}", elapsedMs);
+    AllocationProfiler::beginTick();
 
     try {
         // STEP 1: Process Incoming Packets (Client Inputs)
-        std::vector<common::protocol::Packet> packetsToProcess;
+        // The tick buffers keep their capacity from one tick to the next
+        std::vector<common::protocol::Packet>& packetsToProcess = _tickIncomingPackets;
+        packetsToProcess.clear();
         while (true) {
             auto maybePacket = popIncomingPacket();
             if (!maybePacket.has_value())
                 break;
-            packetsToProcess.push_back(maybePacket.value().packet);
+            packetsToProcess.push_back(std::move(maybePacket->packet));
         }
 
         if (!packetsToProcess.empty()) {
@@ -264,7 +267,10 @@ void Game::serverTick(uint64_t elapsedMs)
         }
 
         // Let coordinator handle packet processing (validation, input queuing)
-        _coordinator->processServerPackets(packetsToProcess, elapsedMs);
+        {
+            PROFILE_ALLOCATIONS("Coordinator::processServerPackets");
+            _coordinator->processServerPackets(packetsToProcess, elapsedMs);
+        }
 
         // STEP 2: Update ECS Systems (Deterministic Order)
         // Server simulates the authoritative game state
@@ -275,7 +281,7 @@ void Game::serverTick(uint64_t elapsedMs)
         }
 
         float deltaSeconds = elapsedMs / 1000.0f;
-        engine->updateSystems(deltaSeconds);
+        _coordinator->updateSystems(deltaSeconds);
 
         // STEP 2.5: Check for level completion (server-side only)
         if (_levelStarted && static_cast<std::size_t>(_currentLevelEntity) != 0) {
@@ -321,8 +327,12 @@ void Game::serverTick(uint64_t elapsedMs)
         }
 
         // STEP 3: Generate Authoritative State Packets
-        std::vector<common::protocol::Packet> outgoingPackets;
-        _coordinator->buildServerPacketBasedOnStatus(outgoingPackets, elapsedMs);
+        std::vector<common::protocol::Packet>& outgoingPackets = _tickOutgoingPackets;
+        outgoingPackets.clear();
+        {
+            PROFILE_ALLOCATIONS("Coordinator::buildServerPacketBasedOnStatus");
+            _coordinator->buildServerPacketBasedOnStatus(outgoingPackets, elapsedMs);
+        }
 
         // STEP 4: Queue Outgoing Packets
         // For PLAYER_INPUT packets, exclude the source player to avoid double-processing
@@ -352,6 +362,18 @@ void Game::serverTick(uint64_t elapsedMs)
         LOG_ERROR("Unexpected error in server tick: {}", e.what());
         throw Error(ErrorType::ServerError, "Server tick failed: " + std::string(e.what()));
     }
+
+    // Transient allocations of this tick (systems, packet building) are released at once
+    FrameArena::nextFrame();
+    AllocationProfiler::endTick();
+    if constexpr (AllocationProfiler::ENABLED) {
+        if (AllocationProfiler::tickCount() >= ALLOCATION_REPORT_INTERVAL) {
+            AllocationProfiler::logReport();
+            std::ofstream dump(ALLOCATION_DUMP_PATH);
+            AllocationProfiler::dump(dump);
+            AllocationProfiler::reset();
+        }
+    }
 }
 
 void Game::clientTick(uint64_t elapsedMs)
@@ -369,12 +391,14 @@ void Game::clientTick(uint64_t elapsedMs)
 
     try {
         // STEP 1: Process Incoming Packets (Server State Updates)
-        std::vector<common::protocol::Packet> packetsToProcess;
+        // The tick buffers keep their capacity from one tick to the next
+        std::vector<common::protocol::Packet>& packetsToProcess = _tickIncomingPackets;
+        packetsToProcess.clear();
         while (true) {
             auto maybePacket = popIncomingPacket();
             if (!maybePacket.has_value())
                 break;
-            packetsToProcess.push_back(maybePacket.value().packet);
+            packetsToProcess.push_back(std::move(maybePacket->packet));
         }
 
         // Let coordinator handle server state updates
@@ -391,7 +415,8 @@ void Game::clientTick(uint64_t elapsedMs)
         // (Server will validate and correct if needed in next update)
 
         // STEP 3: Generate Input Packets to Server
-        std::vector<common::protocol::Packet> outgoingPackets;
+        std::vector<common::protocol::Packet>& outgoingPackets = _tickOutgoingPackets;
+        outgoingPackets.clear();
         try {
             _coordinator->buildClientPacketBasedOnStatus(outgoingPackets, elapsedMs);
         } catch (const std::exception& e) {
@@ -412,6 +437,8 @@ void Game::clientTick(uint64_t elapsedMs)
         LOG_ERROR("Unexpected error in client tick: {}, continuing...", e.what());
         // Don't throw - let the game continue running
     }
+
+    FrameArena::nextFrame();
 }
 
 void Game::addIncomingPacket(const common::network::ReceivedPacket &packet)
@@ -11,12 +11,17 @@
 #include "game/systems/BackgroundSystem.hpp"
 #include "game/systems/CollisionSystem.hpp"
 #include "game/systems/ScoreSystem.hpp"
+#include "game/systems/DamageSystem.hpp"
 #include "game/systems/LevelSystem.hpp"
 #include "game/systems/LevelTimerSystem.hpp"
 #include <game/systems/DestroySystem.hpp>
+#include <engine/core/FrameArena.hpp>
+#include <algorithm>
 
 void Coordinator::initEngine()
 {
+    // The pipeline is attached to the managers of the previous engine
+    this->_serverSystems.reset();
     this->_engine = std::make_shared<gameEngine::GameEngine>();
     this->_engine->init();
 
@@ -43,7 +48,6 @@ void Coordinator::initEngine()
     this->_engine->registerComponent<MovementPattern>();
     this->_engine->registerComponent<AI>();
     this->_engine->registerComponent<ButtonComponent>();
-    this->_engine->registerComponent<GameConfig>();
     this->_engine->registerComponent<Rebind>();
     this->_engine->registerComponent<AudioSource>();
     this->_engine->registerComponent<AudioEffect>();
@@ -52,39 +56,203 @@ void Coordinator::initEngine()
     this->_engine->registerComponent<Level>();
     this->_engine->registerComponent<TimerUI>();
 
-    // Register gameplay systems (both client and server)
-    auto playerSystem = this->_engine->registerSystem<PlayerSystem>(*this->_engine);
+    // Build the component bundles of every spawnable entity once
+    this->registerPrefabs();
+
+    // React to structural changes instead of scanning entities every tick.
+    // The NetworkId value is read when the queue is drained: prefab init
+    // overwrites it after the component is added.
+    this->_engine->onAdd<NetworkId>([this](Entity entity, NetworkId&) {
+        if (this->_isServer)
+            _pendingSpawnBroadcasts.push_back(entity);
+    });
+    // A recycled ID is a new entity for the clients
+    this->_engine->onRemove<NetworkId>([this](Entity, NetworkId& networkId) {
+        _broadcastedEntityIds.erase(networkId.id);
+    });
+    // Every player (local or remote) carries its player ID in InputComponent
+    this->_engine->onRemove<InputComponent>([this](Entity, InputComponent& input) {
+        _playerSpriteAllocator.release(input.playerId);
+    });
+
+    // Gameplay systems. The server runs its fixed set as a SystemPipeline
+    // (see ServerPipeline), in that order and without virtual dispatch, in
+    // SchedulerMode::SEQUENTIAL: Shoot, Level, Collision and Damage declare no
+    // component access and Player and Movement both write Transform, so
+    // PARALLEL would only pair Score with Destroy. The menu systems
+    // below stay in the SystemManager. The client
+    // registers them in the SystemManager, which runs them stage by stage
+    // (input, simulation, physics, post-physics, network-extract, render),
+    // in registration order inside a stage.
+    if (this->_isServer) {
+        this->_serverSystems = this->_engine->createPipeline<PlayerSystem, ShootSystem, LevelSystem,
+            MovementSystem, CollisionSystem, DamageSystem, ScoreSystem, DestroySystem>(
+            std::forward_as_tuple(*this->_engine),
+            std::forward_as_tuple(*this->_engine, *this, this->_isServer),
+            std::forward_as_tuple(*this->_engine, this),
+            std::forward_as_tuple(*this->_engine),
+            std::forward_as_tuple(*this->_engine),
+            std::forward_as_tuple(*this->_engine),
+            std::forward_as_tuple(*this->_engine),
+            std::forward_as_tuple(*this->_engine));
+    } else {
+        this->_engine->registerSystem<PlayerSystem>(SystemStage::INPUT, *this->_engine);
+        this->_engine->registerSystem<ShootSystem>(SystemStage::SIMULATION, *this->_engine, *this, this->_isServer);
+        this->_engine->registerSystem<LevelSystem>(SystemStage::SIMULATION, *this->_engine, this);
+        this->_engine->registerSystem<MovementSystem>(SystemStage::PHYSICS, *this->_engine);
+        // Must run on both client AND server for authoritative damage
+        this->_engine->registerSystem<CollisionSystem>(SystemStage::PHYSICS, *this->_engine);
+        this->_engine->registerSystem<DamageSystem>(SystemStage::PHYSICS, *this->_engine);
+        this->_engine->registerSystem<ScoreSystem>(SystemStage::POST_PHYSICS, *this->_engine);
+        this->_engine->registerSystem<DestroySystem>(SystemStage::POST_PHYSICS, *this->_engine);
+    }
+
     this->_engine->setSystemSignature<PlayerSystem, Velocity, InputComponent>();
+    this->_engine->setSystemReads<PlayerSystem, InputComponent, Sprite>();
+    this->_engine->setSystemWrites<PlayerSystem, Velocity, Transform, Animation>();
 
-    auto movementSystem = this->_engine->registerSystem<MovementSystem>(*this->_engine);
     this->_engine->setSystemSignature<MovementSystem, Transform, Velocity>();
+    this->_engine->setSystemReads<MovementSystem, Velocity>();
+    this->_engine->setSystemWrites<MovementSystem, Transform>();
 
-    auto shootSystem = this->_engine->registerSystem<ShootSystem>(*this->_engine, *this, this->_isServer);
     this->_engine->setSystemSignature<ShootSystem, Weapon, Transform>();
 
-    // Register LevelSystem (server-side only, but registered for both)
-    auto levelSystem = this->_engine->registerSystem<LevelSystem>(*this->_engine, this);
+    // LevelSystem (server-side only, but registered for both)
     this->_engine->setSystemSignature<LevelSystem, Level>();
-    auto buttonSystem = this->_engine->registerSystem<ButtonSystem>(*this->_engine, this->_isServer);
+
+    // Menu systems stay in the SystemManager on both sides
+    auto buttonSystem = this->_engine->registerSystem<ButtonSystem>(SystemStage::INPUT, *this->_engine, this->_isServer);
     this->_engine->setSystemSignature<ButtonSystem, ButtonComponent, Transform>();
 
-    auto accessibilitySystem = this->_engine->registerSystem<AccessibilitySystem>(*this->_engine);
-    this->_engine->setSystemSignature<AccessibilitySystem, GameConfig>();
+    auto accessibilitySystem = this->_engine->registerSystem<AccessibilitySystem>(SystemStage::INPUT, *this->_engine);
+    // GameConfig is a world resource, the system applies it to the texts
+    this->_engine->setSystemSignature<AccessibilitySystem, Text>();
 
-    auto rebindSystem = this->_engine->registerSystem<RebindSystem>(*this->_engine);
+    auto rebindSystem = this->_engine->registerSystem<RebindSystem>(SystemStage::INPUT, *this->_engine);
     this->_engine->setSystemSignature<RebindSystem, Rebind>();
 
     // Score system
-    auto scoreSystem = this->_engine->registerSystem<ScoreSystem>(*this->_engine);
     this->_engine->setSystemSignature<ScoreSystem, Score, Text>();
+    // The hits it reads are written by DamageSystem, which runs exclusively in an earlier stage
+    this->_engine->setSystemWrites<ScoreSystem, Score, Text>();
 
-    // Register CollisionSystem to handle collision detection and team-based damage
-    // Must run on both client AND server for authoritative damage
-    auto collisionSystem = this->_engine->registerSystem<CollisionSystem>(*this->_engine);
-    this->_engine->setSystemSignature<CollisionSystem, Transform, Sprite, HitBox>();
+    // CollisionSystem records the collisions of the tick (CollisionEvents resource),
+    // DamageSystem resolves them; ScoreSystem, DestroySystem and the server packets react
+    this->_engine->setSystemSignature<CollisionSystem, Transform, HitBox>();
+    this->_engine->setSystemSignature<DamageSystem, Health>();
 
-    auto destroySystem = this->_engine->registerSystem<DestroySystem>(*this->_engine);
     this->_engine->setSystemSignature<DestroySystem, Transform>();
+    this->_engine->setSystemReads<DestroySystem, Transform>();
+}
+
+void Coordinator::registerPrefabs()
+{
+    // Per-instance values (position, IDs, sprite, shooter) are written when an instance is spawned
+    this->_prefabs.add(PrefabId::PLAYER, Prefab("Player", EntityCategory::NETWORKED))
+        .with(NetworkId(0))
+        .with(Sprite(PLAYER_1, ZIndex::IS_GAME, sf::IntRect(0, 0, 33, 15)))
+        .with(Animation(33, 15, 2, 0.f, 0.1f, 2, 2, true))
+        .with(Transform(0.f, 0.f, 0.f, 1.5f))
+        .with(Velocity(0.f, 0.f))
+        .with(Health(PLAYER_INITIAL_HEALTH, PLAYER_INITIAL_HEALTH))
+        .with(HitBox::box(PLAYER_SPRITE_WIDTH, PLAYER_SPRITE_HEIGHT))
+        .with(Weapon(200, 0, 10, ProjectileType::MISSILE))
+        .with(InputComponent(0))
+        .with<Team>(TeamType::PLAYER);
+
+    struct EnemyStats {
+        PrefabId id;
+        EnemyType type;
+        float scale;
+        int health;
+        float velX;
+        float velY;
+    };
+    const EnemyStats enemies[] = {
+        {PrefabId::ENEMY_BASIC, EnemyType::BASIC, BASE_ENEMY_SCALE, BASE_ENEMY_HEALTH_START, BASE_ENEMY_VELOCITY_X, BASE_ENEMY_VELOCITY_Y},
+        {PrefabId::ENEMY_FAST, EnemyType::FAST, FAST_ENEMY_SCALE, FAST_ENEMY_HEALTH, FAST_ENEMY_VELOCITY_X, FAST_ENEMY_VELOCITY_Y},
+        {PrefabId::ENEMY_TANK, EnemyType::TANK, TANK_ENEMY_SCALE, TANK_ENEMY_HEALTH, TANK_ENEMY_VELOCITY_X, TANK_ENEMY_VELOCITY_Y},
+        // TODO: Implement boss stats, weapons and AI
+        {PrefabId::ENEMY_BOSS, EnemyType::BOSS, BASE_ENEMY_SCALE, BASE_ENEMY_HEALTH_START, BASE_ENEMY_VELOCITY_X, BASE_ENEMY_VELOCITY_Y},
+    };
+    for (const EnemyStats& stats : enemies) {
+        // Note: No Animation component - enemies are static sprites (no animation/rotation)
+        Prefab& enemy = this->_prefabs.add(stats.id, Prefab("Enemy", EntityCategory::NETWORKED))
+            .with(Transform(0.f, 0.f, 0.f, stats.scale))
+            .with(Velocity(stats.velX, stats.velY))
+            .with(Health(stats.health, stats.health))
+            .with(NetworkId{0, false})
+            .with(Sprite(BASE_ENEMY, ZIndex::IS_GAME, sf::IntRect(0, 0, BASE_ENEMY_SPRITE_WIDTH, BASE_ENEMY_SPRITE_HEIGHT)))
+            .with(HitBox::box(BASE_ENEMY_SPRITE_WIDTH, BASE_ENEMY_SPRITE_HEIGHT))
+            .with<Team>(TeamType::ENEMY)
+            .with(Enemy{stats.type});
+        switch (stats.type) {
+            case EnemyType::BASIC:
+                enemy.with(Weapon(BASE_ENEMY_WEAPON_FIRE_RATE, 0, BASE_ENEMY_WEAPON_DAMAGE, ProjectileType::MISSILE))
+                    .with(AI(AiBehaviour::SHOOTER_TACTIC, 50.f, 50.f));
+                break;
+            case EnemyType::FAST:
+                enemy.with(Weapon(FAST_ENEMY_WEAPON_FIRE_RATE, 0, FAST_ENEMY_WEAPON_DAMAGE, ProjectileType::MISSILE))
+                    .with(AI(AiBehaviour::KAMIKAZE, 50.f, 50.f));
+                break;
+            case EnemyType::TANK:
+                enemy.with(Weapon(TANK_ENEMY_WEAPON_FIRE_RATE, 0, TANK_ENEMY_WEAPON_DAMAGE, ProjectileType::MISSILE))
+                    .with(AI(AiBehaviour::SHOOTER_TACTIC, 50.f, 50.f));
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Projectiles spawned from ENTITY_SPAWN packets (no NetworkId, see setupProjectileEntity);
+    // the HitBox takes the size of the Sprite added with the render components
+    this->_prefabs.add(PrefabId::PROJECTILE, Prefab("Projectile"))
+        .with(Transform(0.f, 0.f, 0.f, 1.f))
+        .with(Velocity(0.f, 0.f))
+        .with(HitBox())
+        .with(Projectile(Entity::fromId(0), true, 10))
+        .with<Team>(TeamType::PLAYER);
+
+    // Projectiles spawned from WEAPON_FIRE, one per weapon type
+    this->_prefabs.add(PrefabId::PROJECTILE_BASIC, Prefab("Projectile"))
+        .with(Transform(0.f, 0.f, DEFAULT_BULLET_ROTATION, DEFAULT_BULLET_SCALE))
+        .with(Velocity(0.f, 0.f))
+        .with(Projectile(Entity::fromId(0), false, 10))
+        .with(Sprite(Assets::DEFAULT_BULLET, ZIndex::IS_GAME,
+            sf::IntRect(0, 0, DEFAULT_BULLET_SPRITE_WIDTH, DEFAULT_BULLET_SPRITE_HEIGHT)))
+        .with(Animation(DEFAULT_BULLET_ANIMATION_WIDTH,
+            DEFAULT_BULLET_ANIMATION_HEIGHT, DEFAULT_BULLET_ANIMATION_CURRENT, DEFAULT_BULLET_ANIMATION_ELAPSED_TIME, DEFAULT_BULLET_ANIMATION_DURATION,
+            DEFAULT_BULLET_ANIMATION_START, DEFAULT_BULLET_ANIMATION_END, DEFAULT_BULLET_ANIMATION_LOOPING))
+        .with(HitBox::box(DEFAULT_BULLET_SPRITE_WIDTH, DEFAULT_BULLET_SPRITE_HEIGHT))
+        .with<Team>(TeamType::ENEMY)
+        .with(AudioSource(AudioAssets::SFX_SHOOT_BASIC, AUDIO_BASIC_PROJECTILE_LOOP, AUDIO_BASIC_PROJECTILE_MIN_DISTANCE, AUDIO_BASIC_PROJECTILE_ATTENUATION, false, AUDIO_SHOOT_BASIC_DURATION));
+
+    this->_prefabs.add(PrefabId::PROJECTILE_CHARGED, Prefab("Projectile"))
+        .with(Transform(0.f, 0.f, CHARGED_BULLET_ROTATION, CHARGED_BULLET_SCALE))
+        .with(Velocity(0.f, 0.f))
+        .with(Projectile(Entity::fromId(0), false, 10))
+        .with(Sprite(Assets::DEFAULT_BULLET, ZIndex::IS_GAME,
+            sf::IntRect(0, 0, CHARGED_BULLET_SPRITE_WIDTH, CHARGED_BULLET_SPRITE_HEIGHT)))
+        .with(Animation(CHARGED_BULLET_ANIMATION_WIDTH,
+            CHARGED_BULLET_ANIMATION_HEIGHT, CHARGED_BULLET_ANIMATION_CURRENT, CHARGED_BULLET_ANIMATION_ELAPSED_TIME, CHARGED_BULLET_ANIMATION_DURATION,
+            CHARGED_BULLET_ANIMATION_START, CHARGED_BULLET_ANIMATION_END, CHARGED_BULLET_ANIMATION_LOOPING))
+        .with(HitBox::box(CHARGED_BULLET_SPRITE_WIDTH, CHARGED_BULLET_SPRITE_HEIGHT))
+        .with<Team>(TeamType::ENEMY)
+        .with(AudioSource(AudioAssets::SFX_SHOOT_CHARGED, AUDIO_CHARGED_PROJECTILE_LOOP, AUDIO_CHARGED_PROJECTILE_MIN_DISTANCE, AUDIO_CHARGED_PROJECTILE_ATTENUATION, false, AUDIO_SHOOT_CHARGED_DURATION));
+}
+
+const Prefab& Coordinator::getEnemyPrefab(EnemyType type) const
+{
+    switch (type) {
+        case EnemyType::FAST:
+            return this->_prefabs.get(PrefabId::ENEMY_FAST);
+        case EnemyType::TANK:
+            return this->_prefabs.get(PrefabId::ENEMY_TANK);
+        case EnemyType::BOSS:
+            return this->_prefabs.get(PrefabId::ENEMY_BOSS);
+        default:
+            return this->_prefabs.get(PrefabId::ENEMY_BASIC);
+    }
 }
 
 void Coordinator::initEngineRender()  // Nouvelle méthode
@@ -93,25 +261,26 @@ void Coordinator::initEngineRender()  // Nouvelle méthode
     this->_engine->initAudio();
 
     // Register BackgroundSystem to handle scrolling backgrounds
-    auto backgroundSystem = this->_engine->registerSystem<BackgroundSystem>(*this->_engine,  this->_isServer);
+    auto backgroundSystem = this->_engine->registerSystem<BackgroundSystem>(SystemStage::SIMULATION, *this->_engine,  this->_isServer);
     this->_engine->setSystemSignature<BackgroundSystem, Transform, Sprite, ScrollingBackground>();
 
-    // Register AnimationSystem before RenderSystem (animation must update before rendering)
-    auto animationSystem = this->_engine->registerSystem<AnimationSystem>(*this->_engine);
+    // AnimationSystem runs in POST_PHYSICS, so animations update before rendering
+    auto animationSystem = this->_engine->registerSystem<AnimationSystem>(SystemStage::POST_PHYSICS, *this->_engine);
     this->_engine->setSystemSignature<AnimationSystem, Animation, Sprite>();
+    this->_engine->setSystemWrites<AnimationSystem, Animation, Sprite>();
 
     // Register AudioSystem to handle entity audio
-    auto audioSystem = this->_engine->registerSystem<AudioSystem>(*this->_engine);
+    auto audioSystem = this->_engine->registerSystem<AudioSystem>(SystemStage::RENDER, *this->_engine);
     this->_engine->setSystemSignature<AudioSystem, AudioSource>();
 
     // Register RenderSystem to handle entity rendering
-    auto renderSystem = this->_engine->registerSystem<RenderSystem>(*this->_engine);
+    auto renderSystem = this->_engine->registerSystem<RenderSystem>(SystemStage::RENDER, *this->_engine);
 
     // Set signature: RenderSystem needs Transform and Sprite components
     this->_engine->setSystemSignature<RenderSystem, Transform, Sprite>();
 
     // Register LevelTimerSystem to update countdown timers
-    auto levelTimerSystem = this->_engine->registerSystem<LevelTimerSystem>(*this->_engine);
+    auto levelTimerSystem = this->_engine->registerSystem<LevelTimerSystem>(SystemStage::POST_PHYSICS, *this->_engine);
     this->_engine->setSystemSignature<LevelTimerSystem, TimerUI, Text>();
 }
 
@@ -164,8 +333,10 @@ Entity Coordinator::createScoreEntity(
 
     this->setupScoreEntity(entity, scoreId, posX, posY, initialScore);
 
-    // Bind this entity as the HUD score target for ScoreSystem
-    this->_engine->getSystem<ScoreSystem>().setHudEntity(entity);
+    // Bind this entity as the HUD score shown by ScoreSystem
+    ScoreBoard& board = this->_engine->getResource<ScoreBoard>();
+    board.hud = entity;
+    board.score = initialScore;
     LOG_INFO_CAT("UI", "ScoreSystem HUD entity set: entityIndex={}",
         static_cast<std::size_t>(entity));
 
@@ -216,7 +387,7 @@ Entity Coordinator::createEnemyEntity(
 )
 {
     // Use createEntityWithId to ensure the entity ID matches the enemy ID
-    Entity entity = this->_engine->createEntityWithId(enemyId, "Enemy_" + std::to_string(enemyId));
+    Entity entity = this->_engine->createEntityWithId(enemyId, "Enemy");
     this->setupEnemyEntity(
         entity,
         enemyId,
@@ -243,7 +414,7 @@ Entity Coordinator::createProjectileEntity(
 )
 {
     // Use createEntityWithId to ensure the entity ID matches the projectile ID
-    Entity entity = this->_engine->createEntityWithId(projectileId, "Projectile_" + std::to_string(projectileId));
+    Entity entity = this->_engine->createEntityWithId(projectileId, "Projectile");
     // Note: shooterId is unknown here, using invalid entity. This function is legacy.
     this->setupProjectileEntity(
         entity,
@@ -275,28 +446,27 @@ void Coordinator::setupPlayerEntity(
     bool withRenderComponents
 )
 {
-    // Common gameplay components (server + client)
-    // CRITICAL: Add NetworkId component so entity is included in server snapshots
-    // Use the entity's actual internal ID (which includes NETWORKED_ID_OFFSET)
-    this->_engine->addComponent<NetworkId>(entity, NetworkId(static_cast<uint32_t>(entity)));
-
-    // Always add Sprite and Animation (needed for CollisionSystem even on server)
+    // Common gameplay components (server + client) come from the PLAYER prefab.
+    // Sprite and Animation are always present (needed for CollisionSystem even on server).
     Assets spriteAsset = _playerSpriteAllocator.allocate(playerId);
-    this->_engine->addComponent<Sprite>(entity, Sprite(spriteAsset, ZIndex::IS_GAME, sf::IntRect(0, 0, 33, 15)));
-    this->_engine->addComponent<Animation>(entity, Animation(33, 15, 2, 0.f, 0.1f, 2, 2, true));
-
-    this->_engine->addComponent<Transform>(entity, Transform(posX, posY, 0.f, 1.5f));
-    this->_engine->addComponent<Velocity>(entity, Velocity(velX, velY));
-    this->_engine->addComponent<Health>(entity, Health(initialHealth, initialHealth));
-    this->_engine->addComponent<HitBox>(entity, HitBox());
-    this->_engine->addComponent<Weapon>(entity, Weapon(200, 0, 10, ProjectileType::MISSILE));
-    this->_engine->addComponent<InputComponent>(entity, InputComponent(playerId));
-    this->_engine->addComponent<Team>(entity, TeamType::PLAYER);
-
-    // If this is the playable player, set it as local player
-    if (isPlayable) {
-        this->_engine->addComponent<Playable>(entity, Playable());
+    this->_engine->applyPrefab(entity, this->_prefabs.get(PrefabId::PLAYER), [&](Entity e) {
+        // CRITICAL: NetworkId makes the entity part of server snapshots.
+        // Use the entity's actual internal ID (which includes NETWORKED_ID_OFFSET)
+        this->_engine->getComponentEntity<NetworkId>(e)->id = static_cast<uint32_t>(e);
+        this->_engine->getComponentEntity<Sprite>(e)->assetId = spriteAsset;
+        auto& transform = this->_engine->getComponentEntity<Transform>(e);
+        transform->x = posX;
+        transform->y = posY;
+        this->_engine->getComponentEntity<Velocity>(e) = Velocity(velX, velY);
+        this->_engine->getComponentEntity<Health>(e) = Health(initialHealth, initialHealth);
+        this->_engine->getComponentEntity<InputComponent>(e)->playerId = playerId;
+
+        // If this is the playable player, set it as local player
+        if (isPlayable)
+            this->_engine->addComponent<Playable>(e, Playable());
+    });
 
+    if (isPlayable) {
         //FIXME: fix here the method in game engine
         // this->_engine->setLocalPlayerEntity(entity, playerId);
         LOG_INFO_CAT("Coordinator", "Local player created with ID {}", playerId);
@@ -350,70 +520,24 @@ void Coordinator::setupEnemyEntity(
     bool withRenderComponents
 )
 {
-    // Determine scale based on enemy type
-    float enemyScale = BASE_ENEMY_SCALE;
-    switch (enemyType) {
-        case EnemyType::BASIC:
-            enemyScale = BASE_ENEMY_SCALE;
-            break;
-        case EnemyType::FAST:
-            enemyScale = FAST_ENEMY_SCALE;
-            break;
-        case EnemyType::TANK:
-            enemyScale = TANK_ENEMY_SCALE;
-            break;
-        default:
-            enemyScale = BASE_ENEMY_SCALE;
-            break;
-    }
+    // Scale, Sprite, Weapon and AI come from the prefab of the enemy type
+    const Prefab& prefab = this->getEnemyPrefab(enemyType);
+    this->_engine->applyPrefab(entity, prefab, [&](Entity e) {
+        auto& transform = this->_engine->getComponentEntity<Transform>(e);
+        transform->x = posX;
+        transform->y = posY;
+        this->_engine->getComponentEntity<Velocity>(e) = Velocity(velX, velY);
+        this->_engine->getComponentEntity<Health>(e) = Health(initialHealth, initialHealth);
+        // NetworkId keeps the enemy synchronized to clients.
+        // Use the entity's actual internal ID (which includes NETWORKED_ID_OFFSET)
+        this->_engine->getComponentEntity<NetworkId>(e)->id = static_cast<uint32_t>(e);
+
+        if (withRenderComponents)
+            this->_engine->addComponent<Drawable>(e, Drawable{});
+    });
 
-    this->_engine->addComponent<Transform>(entity, Transform(posX, posY, 0.f, enemyScale));
-    this->_engine->addComponent<Velocity>(entity, Velocity(velX, velY));
-    this->_engine->addComponent<Health>(entity, Health(initialHealth, initialHealth));
-    
-    // Add NetworkId so enemy is synchronized to clients
-    // Use the entity's actual internal ID (which includes NETWORKED_ID_OFFSET)
-    this->_engine->addComponent<NetworkId>(entity, NetworkId{static_cast<uint32_t>(entity), false});
-    
-    // Always add Sprite (needed for CollisionSystem even on server)
-    // IntRect: (left, top, width, height) - defines which part of the texture to display
-    this->_engine->addComponent<Sprite>(entity, Sprite(BASE_ENEMY, ZIndex::IS_GAME, sf::IntRect(0, 0, BASE_ENEMY_SPRITE_WIDTH, BASE_ENEMY_SPRITE_HEIGHT)));
-    this->_engine->addComponent<HitBox>(entity, HitBox());
-    
-    // Note: No Animation component - enemies are static sprites (no animation/rotation)
-    // If animation is needed later, configure startFrame == endFrame for static display
-    // or set proper animation frames for actual sprite animation
-    
     LOG_DEBUG_CAT("Coordinator", "setupEnemyEntity: entity={} enemyId={} type={} scale={} sprite.rect=({},{},{}x{})",
-        static_cast<size_t>(entity), enemyId, static_cast<int>(enemyType), enemyScale, 0, 0, BASE_ENEMY_SPRITE_WIDTH, BASE_ENEMY_SPRITE_HEIGHT);
-    
-    // Add Weapon and AI components based on enemy type
-    switch (enemyType) {
-        case EnemyType::BASIC:
-            this->_engine->addComponent<Weapon>(entity, Weapon(BASE_ENEMY_WEAPON_FIRE_RATE, 0, BASE_ENEMY_WEAPON_DAMAGE, ProjectileType::MISSILE));
-            this->_engine->addComponent<AI>(entity, AI(AiBehaviour::SHOOTER_TACTIC, 50.f, 50.f));
-            break;
-        case EnemyType::FAST:
-            this->_engine->addComponent<Weapon>(entity, Weapon(FAST_ENEMY_WEAPON_FIRE_RATE, 0, FAST_ENEMY_WEAPON_DAMAGE, ProjectileType::MISSILE));
-            this->_engine->addComponent<AI>(entity, AI(AiBehaviour::KAMIKAZE, 50.f, 50.f));
-            break;
-        case EnemyType::TANK:
-            this->_engine->addComponent<Weapon>(entity, Weapon(TANK_ENEMY_WEAPON_FIRE_RATE, 0, TANK_ENEMY_WEAPON_DAMAGE, ProjectileType::MISSILE));
-            this->_engine->addComponent<AI>(entity, AI(AiBehaviour::SHOOTER_TACTIC, 50.f, 50.f));
-            break;
-        case EnemyType::BOSS:
-            // TODO: Implement boss weapons/AI
-            break;
-        default:
-            break;
-    }
-
-    this->_engine->addComponent<Team>(entity, TeamType::ENEMY);
-    this->_engine->addComponent<Enemy>(entity, Enemy{enemyType});
-    
-    if (withRenderComponents) {
-        this->_engine->addComponent<Drawable>(entity, Drawable{});
-    }
+        static_cast<size_t>(entity), enemyId, static_cast<int>(enemyType), prefab.get<Transform>()->scale, 0, 0, BASE_ENEMY_SPRITE_WIDTH, BASE_ENEMY_SPRITE_HEIGHT);
 }
 
 void Coordinator::setupProjectileEntity(
@@ -434,16 +558,18 @@ void Coordinator::setupProjectileEntity(
     // The server spawns them via WEAPON_FIRE packets with position + velocity,
     // and clients simulate movement locally using the MovementSystem.
     // The server only sends ENTITY_DESTROY or hit events when needed.
-    
-    this->_engine->addComponent<Transform>(entity, Transform(posX, posY, 0.f, 1.f));
-    this->_engine->addComponent<Velocity>(entity, Velocity(velX, velY));
-    if (withRenderComponents) {
-        this->_engine->addComponent<Sprite>(entity, Sprite(DEFAULT_BULLET, ZIndex::IS_GAME, sf::IntRect(0, 0, 16, 16)));
-    }
-    this->_engine->addComponent<HitBox>(entity, HitBox());
-    this->_engine->addComponent<Projectile>(entity, Projectile(shooterId, isPlayerProjectile, damage));
-    // Projectiles inherit team from their shooter
-    this->_engine->addComponent<Team>(entity, isPlayerProjectile ? TeamType::PLAYER : TeamType::ENEMY);
+    this->_engine->applyPrefab(entity, this->_prefabs.get(PrefabId::PROJECTILE), [&](Entity e) {
+        auto& transform = this->_engine->getComponentEntity<Transform>(e);
+        transform->x = posX;
+        transform->y = posY;
+        this->_engine->getComponentEntity<Velocity>(e) = Velocity(velX, velY);
+        this->_engine->getComponentEntity<Projectile>(e) = Projectile(shooterId, isPlayerProjectile, damage);
+        // Projectiles inherit team from their shooter
+        this->_engine->getComponentEntity<Team>(e) = Team(isPlayerProjectile ? TeamType::PLAYER : TeamType::ENEMY);
+
+        if (withRenderComponents)
+            this->_engine->addComponent<Sprite>(e, Sprite(DEFAULT_BULLET, ZIndex::IS_GAME, sf::IntRect(0, 0, 16, 16)));
+    });
 }
 
 Entity Coordinator::createLevelEntity(int levelNumber, float duration, const std::string& backgroundAsset, const std::string& soundTheme)
@@ -760,28 +886,91 @@ void Coordinator::buildServerPacketBasedOnStatus(std::vector<common::protocol::P
     // ============================================================================
     // NEW ENTITY BROADCAST
     // ============================================================================
-    // Detect newly created entities with NetworkId and broadcast ENTITY_SPAWN packets
+    // Entities that gained a NetworkId since the last tick (queued by the
+    // onAdd<NetworkId> observer) get an ENTITY_SPAWN packet
     // This ensures clients know about new enemies, powerups, etc. created server-side
     // ============================================================================
-    auto& networkIdComponents = this->_engine->getComponents<NetworkId>();
-    const auto& networkedEntities = this->_engine->getNetworkedEntities();
     static uint32_t entitySpawnSequence = 0;
-    
-    for (size_t entityId : networkedEntities) {
-        if (entityId < networkIdComponents.size() && networkIdComponents[entityId].has_value()) {
-            uint32_t networkId = networkIdComponents[entityId].value().id;
-            Entity entity = Entity::fromId(static_cast<uint32_t>(entityId));
-            
-            // Check if this entity has been broadcast yet
-            if (this->_engine->isAlive(entity) && _broadcastedEntityIds.find(networkId) == _broadcastedEntityIds.end()) {
-                // New entity! Create and send ENTITY_SPAWN packet
-                common::protocol::Packet spawnPacket;
-                entitySpawnSequence++;
-                if (createPacketEntitySpawn(&spawnPacket, networkId, entitySpawnSequence)) {
-                    outgoingPackets.push_back(spawnPacket);
-                    _broadcastedEntityIds.insert(networkId);
-                    LOG_INFO_CAT("Coordinator", "Broadcasting ENTITY_SPAWN for new entity {}", networkId);
-                }
+
+    for (Entity entity : _pendingSpawnBroadcasts) {
+        if (!this->_engine->isAlive(entity) || !this->_engine->hasComponent<NetworkId>(entity))
+            continue;
+        uint32_t networkId = this->_engine->getComponentEntity<NetworkId>(entity)->id;
+
+        // Entities announced by their own packet (players) are already marked
+        if (_broadcastedEntityIds.find(networkId) == _broadcastedEntityIds.end()) {
+            common::protocol::Packet spawnPacket;
+            entitySpawnSequence++;
+            if (createPacketEntitySpawn(&spawnPacket, networkId, entitySpawnSequence)) {
+                outgoingPackets.push_back(spawnPacket);
+                _broadcastedEntityIds.insert(networkId);
+                LOG_INFO_CAT("Coordinator", "Broadcasting ENTITY_SPAWN for new entity {}", networkId);
+            }
+        }
+    }
+    _pendingSpawnBroadcasts.clear();
+
+    // ============================================================================
+    // HIT EVENTS → PLAYER_HIT / VISUAL_EFFECT
+    // ============================================================================
+    // DamageSystem resolved this tick's collisions into HitEvents: every hit
+    // player gets a PLAYER_HIT, every kill an explosion on the clients
+    // ============================================================================
+    static uint32_t hitEventSequence = 0;
+
+    if (const CollisionEvents* collisions = this->_engine->tryGetResource<CollisionEvents>()) {
+        auto& networkIds = this->_engine->getComponents<NetworkId>();
+        auto& healths = this->_engine->getComponents<Health>();
+        std::vector<uint8_t>& args = _packetArgs;
+        // Args format: flags_count(1) + flags(1) + header + payload
+        auto writeHeader = [&](size_t payloadSize) {
+            args.assign(2 + HEADER_SIZE + payloadSize, 0);
+            args[0] = 1;
+            args[1] = static_cast<uint8_t>(protocol::PacketFlags::FLAG_RELIABLE);
+            uint32_t timestamp = static_cast<uint32_t>(elapsedMs);
+            ++hitEventSequence;
+            std::memcpy(args.data() + 2, &hitEventSequence, sizeof(uint32_t));
+            std::memcpy(args.data() + 6, &timestamp, sizeof(uint32_t));
+            return args.data() + 10;
+        };
+
+        for (const HitEvent& hit : collisions->hits) {
+            int16_t posX = static_cast<int16_t>(hit.x);
+            int16_t posY = static_cast<int16_t>(hit.y);
+            const NetworkId* networkId = networkIds.tryGet(hit.target);
+            const Health* health = healths.tryGet(hit.target);
+            if (hit.playerHit && networkId && health) {
+                uint8_t* ptr = writeHeader(PLAYER_HIT_PAYLOAD_SIZE);
+                std::memcpy(ptr, &networkId->id, PLAYER_HIT_PLAYER_ID_SIZE);
+                ptr += PLAYER_HIT_PLAYER_ID_SIZE;
+                // The projectile ID, as announced by WEAPON_FIRE
+                std::memcpy(ptr, &hit.source, PLAYER_HIT_ATTACKER_ID_SIZE);
+                ptr += PLAYER_HIT_ATTACKER_ID_SIZE;
+                *ptr++ = static_cast<uint8_t>(std::clamp(hit.damage, 1, 255));
+                *ptr++ = static_cast<uint8_t>(std::clamp(health->currentHealth, 0, 255));
+                *ptr++ = 0;     // remaining_shield
+                std::memcpy(ptr, &posX, PLAYER_HIT_HIT_POS_X_SIZE);
+                ptr += PLAYER_HIT_HIT_POS_X_SIZE;
+                std::memcpy(ptr, &posY, PLAYER_HIT_HIT_POS_Y_SIZE);
+                if (auto packet = PacketManager::createPlayerHit(args))
+                    outgoingPackets.push_back(std::move(*packet));
+            }
+            if (hit.killed) {
+                uint8_t* ptr = writeHeader(VISUAL_EFFECT_PAYLOAD_SIZE);
+                *ptr++ = static_cast<uint8_t>(protocol::VisualEffectType::VFX_EXPLOSION_SMALL);
+                std::memcpy(ptr, &posX, VISUAL_EFFECT_POS_X_SIZE);
+                ptr += VISUAL_EFFECT_POS_X_SIZE;
+                std::memcpy(ptr, &posY, VISUAL_EFFECT_POS_Y_SIZE);
+                ptr += VISUAL_EFFECT_POS_Y_SIZE;
+                uint16_t durationMs = SMALL_EXPLOSION_DURATION_MS;
+                std::memcpy(ptr, &durationMs, VISUAL_EFFECT_DURATION_MS_SIZE);
+                ptr += VISUAL_EFFECT_DURATION_MS_SIZE;
+                *ptr++ = static_cast<uint8_t>(SMALL_EXPLOSION_SPRITE_SCALE * 100.f);
+                *ptr++ = 255;   // No tint
+                *ptr++ = 255;
+                *ptr = 255;
+                if (auto packet = PacketManager::createVisualEffect(args))
+                    outgoingPackets.push_back(std::move(*packet));
             }
         }
     }
@@ -796,6 +985,8 @@ void Coordinator::buildServerPacketBasedOnStatus(std::vector<common::protocol::P
     // ============================================================================
     
     // Get all networked entities (entities with NetworkId component)
+    auto& networkIdComponents = this->_engine->getComponents<NetworkId>();
+    const auto& networkedEntities = this->_engine->getNetworkedEntities();
 
     if (networkedEntities.size() == 0) {
         // No entities to sync
@@ -804,7 +995,9 @@ void Coordinator::buildServerPacketBasedOnStatus(std::vector<common::protocol::P
 
     // Collect all entity IDs that need to be synchronized
     // (Players, enemies, powerups - but NOT projectiles)
-    std::vector<uint32_t> entityIds;
+    // Per-tick lists live in the frame arena, released when the tick ends
+    std::pmr::vector<uint32_t> entityIds(&FrameArena::local());
+    entityIds.reserve(networkedEntities.size());
     for (size_t entityId : networkedEntities) {
         if (entityId < networkIdComponents.size() && networkIdComponents[entityId].has_value()) {
             Entity entity = Entity::fromId(static_cast<uint32_t>(entityId));
@@ -825,50 +1018,54 @@ void Coordinator::buildServerPacketBasedOnStatus(std::vector<common::protocol::P
     // Create Transform Snapshot for all networked entities
     common::protocol::Packet transformPacket;
     if (createPacketTransformSnapshot(&transformPacket, entityIds, sequenceNumber)) {
-        outgoingPackets.push_back(transformPacket);
+        outgoingPackets.push_back(std::move(transformPacket));
         LOG_INFO_CAT("Coordinator", "buildServerPacketBasedOnStatus: created Transform snapshot for {} entities (seq={})", entityIds.size(), sequenceNumber);
     }
 
-    // Create Health Snapshot for all networked entities with Health component
-    std::vector<uint32_t> healthEntityIds;
-    for (uint32_t entityId : entityIds) {
-        Entity entity = this->_engine->getEntityFromId(entityId);
-        if (this->_engine->isAlive(entity)) {
-            auto healthOpt = this->_engine->getComponentEntity<Health>(entity);
-            if (healthOpt.has_value()) {
-                healthEntityIds.push_back(entityId);
-            }
-        }
-    }
+    // Health and Weapon rarely change: only the components written since the
+    // previous snapshot are sent, plus a full refresh every
+    // SNAPSHOT_FULL_REFRESH_INTERVAL snapshots to recover from lost packets
+    bool fullRefresh = sequenceNumber % SNAPSHOT_FULL_REFRESH_INTERVAL == 1;
+    uint32_t sinceTick = fullRefresh ? 0 : _lastSnapshotTick;
+    auto isSynchronized = [&](size_t entityId) {
+        return EntityManager::isNetworkedId(entityId) && networkIdComponents.contains(entityId)
+            && this->_engine->isAlive(Entity::fromId(entityId));
+    };
+
+    // Create Health Snapshot for networked entities whose Health changed
+    std::pmr::vector<uint32_t> healthEntityIds(&FrameArena::local());
+    this->_engine->forEachChangedSince<Health>(sinceTick, [&](size_t entityId, Health&) {
+        if (isSynchronized(entityId))
+            healthEntityIds.push_back(networkIdComponents.get(entityId).id);
+    });
 
     if (!healthEntityIds.empty()) {
         common::protocol::Packet healthPacket;
         if (createPacketHealthSnapshot(&healthPacket, healthEntityIds, sequenceNumber)) {
-            outgoingPackets.push_back(healthPacket);
+            outgoingPackets.push_back(std::move(healthPacket));
             LOG_DEBUG_CAT("Coordinator", "buildSeverPacketBasedOnStatus: created Health snapshot for {} entities", healthEntityIds.size());
         }
     }
 
-    // Create Weapon Snapshot for all networked entities with Weapon component
-    std::vector<uint32_t> weaponEntityIds;
-    for (uint32_t entityId : entityIds) {
-        Entity entity = this->_engine->getEntityFromId(entityId);
-        if (this->_engine->isAlive(entity)) {
-            auto weaponOpt = this->_engine->getComponentEntity<Weapon>(entity);
-            if (weaponOpt.has_value()) {
-                weaponEntityIds.push_back(entityId);
-            }
-        }
-    }
+    // Create Weapon Snapshot for networked entities whose Weapon changed
+    std::pmr::vector<uint32_t> weaponEntityIds(&FrameArena::local());
+    this->_engine->forEachChangedSince<Weapon>(sinceTick, [&](size_t entityId, Weapon&) {
+        if (isSynchronized(entityId))
+            weaponEntityIds.push_back(networkIdComponents.get(entityId).id);
+    });
 
     if (!weaponEntityIds.empty()) {
         common::protocol::Packet weaponPacket;
         if (createPacketWeaponSnapshot(&weaponPacket, weaponEntityIds, sequenceNumber)) {
-            outgoingPackets.push_back(weaponPacket);
+            outgoingPackets.push_back(std::move(weaponPacket));
             LOG_DEBUG_CAT("Coordinator", "buildSeverPacketBasedOnStatus: created Weapon snapshot for {} entities", weaponEntityIds.size());
         }
     }
 
+    // Writes made from now on belong to the next snapshot
+    _lastSnapshotTick = this->_engine->getChangeTick();
+    this->_engine->advanceChangeTick();
+
     // ============================================================================
     // WEAPON FIRE EVENTS → PROJECTILE SPAWNING
     // ============================================================================
@@ -890,8 +1087,8 @@ void Coordinator::buildServerPacketBasedOnStatus(std::vector<common::protocol::P
         if (this->_engine->isAlive(shooterEntity)) {
             // Create weapon fire packet to broadcast to clients
             // Args format: flags_count(1) + flags(1+) + sequence_number(4) + timestamp(4) + payload(17)
-            std::vector<uint8_t> weaponFireArgs;
-            weaponFireArgs.resize(WEAPON_FIRE_MIN_ARGS_SIZE);
+            std::vector<uint8_t>& weaponFireArgs = _packetArgs;
+            weaponFireArgs.assign(WEAPON_FIRE_MIN_ARGS_SIZE, 0);
             uint8_t* ptr = weaponFireArgs.data();
 
             // flags_count (1 byte)
@@ -949,7 +1146,7 @@ void Coordinator::buildServerPacketBasedOnStatus(std::vector<common::protocol::P
 
             auto weaponFirePacket = PacketManager::createWeaponFire(weaponFireArgs);
             if (weaponFirePacket.has_value()) {
-                outgoingPackets.push_back(weaponFirePacket.value());
+                outgoingPackets.push_back(std::move(*weaponFirePacket));
                 LOG_INFO_CAT("Coordinator", "buildServerPacketBasedOnStatus: created weapon fire packet for shooter {} projectile {}", 
                              fireEvent.shooterId, fireEvent.projectileId);
             }
@@ -1445,8 +1642,8 @@ void Coordinator::handlePacketCreateEntity(const common::protocol::Packet& packe
         payload.entity_id, payload.entity_type, static_cast<float>(payload.position_x), static_cast<float>(payload.position_y), payload.initial_health, payload.is_playable);
 
     // Check if entity already exists in NETWORKED list
-    const auto& networkedEntities = this->_engine->getNetworkedEntities();
-    if (networkedEntities.find(payload.entity_id) != networkedEntities.end()) {
+    if (EntityManager::isNetworkedId(payload.entity_id)
+        && this->_engine->isAlive(this->_engine->getEntityFromId(payload.entity_id))) {
         // If incoming entity is a PLAYER, destroy the existing entity (likely a projectile)
         // and create the player instead - players have priority over projectiles
         if (payload.entity_type == static_cast<uint8_t>(protocol::EntityTypes::ENTITY_TYPE_PLAYER)) {
@@ -1464,7 +1661,7 @@ void Coordinator::handlePacketCreateEntity(const common::protocol::Packet& packe
     // Create the entity with the specific ID from the server
     Entity newEntity = Entity::fromId(0);  // Placeholder, will be replaced
     try {
-        newEntity = this->_engine->createEntityWithId(payload.entity_id, "Entity_" + std::to_string(payload.entity_id));
+        newEntity = this->_engine->createEntityWithId(payload.entity_id, "Entity");
         LOG_DEBUG_CAT("Coordinator", "handlePacketCreateEntity: Successfully created entity {}", payload.entity_id);
     } catch (const Error& e) {
         LOG_ERROR_CAT("Coordinator", "handlePacketCreateEntity: Failed to create entity {}: {}", payload.entity_id, e.what());
@@ -1953,6 +2150,7 @@ void Coordinator::handlePacketPlayerHit(const common::protocol::Packet &packet)
     {
         auto& health = this->_engine->getComponentEntity<Health>(playerHit);
         health->currentHealth = payload.remaining_health;
+        this->_engine->markDirty<Health>(playerHit);
         // TODO: handle the shied here, add a component and add the remaining_shield
 
         LOG_INFO_CAT("Coordinator", "Player {} health updated: hp={} shield={}",
@@ -2787,7 +2985,8 @@ bool Coordinator::createPacketEntitySpawn(common::protocol::Packet* packet, uint
     Transform& transform = transformOpt.value();
 
     // Build args vector for PacketManager
-    std::vector<uint8_t> args;
+    std::vector<uint8_t>& args = _packetArgs;
+    args.clear();
 
     // flags_count (1 for FLAG_RELIABLE)
     uint8_t flags_count = 1;
@@ -2861,13 +3060,13 @@ bool Coordinator::createPacketEntitySpawn(common::protocol::Packet* packet, uint
     }
 
     // Copy to output packet
-    *packet = result.value();
+    *packet = std::move(*result);
 
     LOG_DEBUG_CAT("Coordinator", "createPacketEntitySpawn: created packet for entity {}", entityId);
     return true;
 }
 
-bool Coordinator::createPacketTransformSnapshot(common::protocol::Packet* packet, const std::vector<uint32_t>& entityIds, uint32_t sequence_number)
+bool Coordinator::createPacketTransformSnapshot(common::protocol::Packet* packet, std::span<const uint32_t> entityIds, uint32_t sequence_number)
 {
     if (!packet) {
         LOG_ERROR_CAT("Coordinator", "createPacketTransformSnapshot: null packet pointer");
@@ -2875,7 +3074,8 @@ bool Coordinator::createPacketTransformSnapshot(common::protocol::Packet* packet
     }
 
     // Build args vector
-    std::vector<uint8_t> args;
+    std::vector<uint8_t>& args = _packetArgs;
+    args.clear();
 
     // flags_count (0 for now)
     uint8_t flags_count = 0;
@@ -2949,19 +3149,20 @@ bool Coordinator::createPacketTransformSnapshot(common::protocol::Packet* packet
         return false;
     }
 
-    *packet = result.value();
+    *packet = std::move(*result);
     LOG_DEBUG_CAT("Coordinator", "createPacketTransformSnapshot: created packet for {} entities", entityIds.size());
     return true;
 }
 
-bool Coordinator::createPacketHealthSnapshot(common::protocol::Packet* packet, const std::vector<uint32_t>& entityIds, uint32_t sequence_number)
+bool Coordinator::createPacketHealthSnapshot(common::protocol::Packet* packet, std::span<const uint32_t> entityIds, uint32_t sequence_number)
 {
     if (!packet) {
         LOG_ERROR_CAT("Coordinator", "createPacketHealthSnapshot: null packet pointer");
         return false;
     }
 
-    std::vector<uint8_t> args;
+    std::vector<uint8_t>& args = _packetArgs;
+    args.clear();
 
     // flags_count
     uint8_t flags_count = 0;
@@ -3038,19 +3239,20 @@ bool Coordinator::createPacketHealthSnapshot(common::protocol::Packet* packet, c
         return false;
     }
 
-    *packet = result.value();
+    *packet = std::move(*result);
     LOG_DEBUG_CAT("Coordinator", "createPacketHealthSnapshot: created packet for {} entities", entityIds.size());
     return true;
 }
 
-bool Coordinator::createPacketWeaponSnapshot(common::protocol::Packet* packet, const std::vector<uint32_t>& entityIds, uint32_t sequence_number)
+bool Coordinator::createPacketWeaponSnapshot(common::protocol::Packet* packet, std::span<const uint32_t> entityIds, uint32_t sequence_number)
 {
     if (!packet) {
         LOG_ERROR_CAT("Coordinator", "createPacketWeaponSnapshot: null packet pointer");
         return false;
     }
 
-    std::vector<uint8_t> args;
+    std::vector<uint8_t>& args = _packetArgs;
+    args.clear();
 
     // flags_count
     uint8_t flags_count = 0;
@@ -3117,7 +3319,7 @@ bool Coordinator::createPacketWeaponSnapshot(common::protocol::Packet* packet, c
         return false;
     }
 
-    *packet = result.value();
+    *packet = std::move(*result);
     LOG_DEBUG_CAT("Coordinator", "createPacketWeaponSnapshot: created packet for {} entities", entityIds.size());
     return true;
 }
@@ -3143,7 +3345,8 @@ bool Coordinator::createPacketEntityDestroy(common::protocol::Packet* packet, ui
         }
     }
 
-    std::vector<uint8_t> args;
+    std::vector<uint8_t>& args = _packetArgs;
+    args.clear();
 
     // flags_count
     uint8_t flags_count = 0;
@@ -3184,7 +3387,7 @@ bool Coordinator::createPacketEntityDestroy(common::protocol::Packet* packet, ui
         return false;
     }
 
-    *packet = result.value();
+    *packet = std::move(*result);
     LOG_DEBUG_CAT("Coordinator", "createPacketEntityDestroy: created packet for entity {}", entityId);
     return true;
 }
@@ -3195,13 +3398,19 @@ std::shared_ptr<gameEngine::GameEngine> Coordinator::getEngine() const
     return this->_engine;
 }
 
+void Coordinator::updateSystems(float dt)
+{
+    this->_engine->updateSystems(dt);
+    if (this->_serverSystems)
+        this->_serverSystems->update(dt);
+}
+
 Entity Coordinator::spawnProjectile(Entity shooter, uint32_t projectile_id, uint8_t weapon_type, float origin_x, float origin_y, float dir_x, float dir_y)
 {
     LOG_DEBUG_CAT("Coordinator", "spawnProjectile: START - projectile_id={} weapon_type={}", projectile_id, weapon_type);
     
     bool isFromPlayable = false;
-    std::string projectileName = "projectile_" + std::to_string(projectile_id);
-    
+
     // Get damage from shooter's weapon if available, otherwise use default
     uint16_t projectileDamage = 10; // Default damage
     
@@ -3225,51 +3434,19 @@ Entity Coordinator::spawnProjectile(Entity shooter, uint32_t projectile_id, uint
     }
 
     LOG_DEBUG_CAT("Coordinator", "spawnProjectile: About to createEntityWithId {}", projectile_id);
-    Entity projectile = this->_engine->createEntityWithId(projectile_id, projectileName);
+    Entity projectile = this->_engine->createEntityWithId(projectile_id, "Projectile");
     LOG_DEBUG_CAT("Coordinator", "spawnProjectile: Entity created successfully");
     
     float projectileSpeed = BULLET_SPEED;  // tuned for visible travel with dt in ms
 
+    const Prefab* prefab = nullptr;
     switch (weapon_type) {
         case 0x00: // WEAPON_TYPE_BASIC
-            LOG_DEBUG_CAT("Coordinator", "spawnProjectile: Adding Transform component");
-            this->_engine->addComponent<Transform>(projectile, Transform(origin_x, origin_y, DEFAULT_BULLET_ROTATION, DEFAULT_BULLET_SCALE));
-            LOG_DEBUG_CAT("Coordinator", "spawnProjectile: Adding Velocity component");
-            this->_engine->addComponent<Velocity>(projectile, Velocity(dir_x * projectileSpeed, dir_y * projectileSpeed));
-            LOG_DEBUG_CAT("Coordinator", "spawnProjectile: Adding Projectile component");
-            this->_engine->addComponent<Projectile>(projectile, Projectile(shooter, isFromPlayable, projectileDamage));
-            LOG_DEBUG_CAT("Coordinator", "spawnProjectile: Adding Sprite component");
-            this->_engine->addComponent<Sprite>(projectile, Sprite(Assets::DEFAULT_BULLET, ZIndex::IS_GAME,
-                sf::IntRect(0, 0, DEFAULT_BULLET_SPRITE_WIDTH, DEFAULT_BULLET_SPRITE_HEIGHT)));
-            this->_engine->addComponent<Animation>(projectile, Animation(DEFAULT_BULLET_ANIMATION_WIDTH,
-                DEFAULT_BULLET_ANIMATION_HEIGHT, DEFAULT_BULLET_ANIMATION_CURRENT, DEFAULT_BULLET_ANIMATION_ELAPSED_TIME, DEFAULT_BULLET_ANIMATION_DURATION,
-                DEFAULT_BULLET_ANIMATION_START, DEFAULT_BULLET_ANIMATION_END, DEFAULT_BULLET_ANIMATION_LOOPING));
-                sf::IntRect(0, 0, DEFAULT_BULLET_SPRITE_WIDTH, DEFAULT_BULLET_SPRITE_HEIGHT);
-            LOG_DEBUG_CAT("Coordinator", "spawnProjectile: Adding Animation component");
-            this->_engine->addComponent<Animation>(projectile, Animation(DEFAULT_BULLET_ANIMATION_WIDTH,
-                DEFAULT_BULLET_ANIMATION_HEIGHT, DEFAULT_BULLET_ANIMATION_CURRENT, DEFAULT_BULLET_ANIMATION_ELAPSED_TIME, DEFAULT_BULLET_ANIMATION_DURATION,
-                DEFAULT_BULLET_ANIMATION_START, DEFAULT_BULLET_ANIMATION_END, DEFAULT_BULLET_ANIMATION_LOOPING));
-            LOG_DEBUG_CAT("Coordinator", "spawnProjectile: Adding HitBox component");
-            this->_engine->addComponent<HitBox>(projectile, HitBox());
-            LOG_DEBUG_CAT("Coordinator", "spawnProjectile: Adding Team component");
-            this->_engine->addComponent<Team>(projectile, isFromPlayable ? TeamType::PLAYER : TeamType::ENEMY);
-            LOG_DEBUG_CAT("Coordinator", "spawnProjectile: Adding AudioSource component for basic projectile");
-            this->_engine->addComponent<AudioSource>(projectile, AudioSource(AudioAssets::SFX_SHOOT_BASIC, AUDIO_BASIC_PROJECTILE_LOOP, AUDIO_BASIC_PROJECTILE_MIN_DISTANCE, AUDIO_BASIC_PROJECTILE_ATTENUATION, false, AUDIO_SHOOT_BASIC_DURATION));
-            LOG_DEBUG_CAT("Coordinator", "spawnProjectile: All components added successfully");
+            prefab = &this->_prefabs.get(PrefabId::PROJECTILE_BASIC);
             break;
 
         case 0x01: // WEAPON_TYPE_CHARGED
-            this->_engine->addComponent<Transform>(projectile, Transform(origin_x, origin_y, CHARGED_BULLET_ROTATION, CHARGED_BULLET_SCALE));
-            this->_engine->addComponent<Velocity>(projectile, Velocity(dir_x * projectileSpeed, dir_y * projectileSpeed));
-            this->_engine->addComponent<Projectile>(projectile, Projectile(shooter, isFromPlayable, projectileDamage));
-            this->_engine->addComponent<Sprite>(projectile, Sprite(Assets::DEFAULT_BULLET, ZIndex::IS_GAME,
-                sf::IntRect(0, 0, CHARGED_BULLET_SPRITE_WIDTH, CHARGED_BULLET_SPRITE_HEIGHT)));
-            this->_engine->addComponent<Animation>(projectile, Animation(CHARGED_BULLET_ANIMATION_WIDTH,
-                CHARGED_BULLET_ANIMATION_HEIGHT, CHARGED_BULLET_ANIMATION_CURRENT, CHARGED_BULLET_ANIMATION_ELAPSED_TIME, CHARGED_BULLET_ANIMATION_DURATION,
-                CHARGED_BULLET_ANIMATION_START, CHARGED_BULLET_ANIMATION_END, CHARGED_BULLET_ANIMATION_LOOPING));
-            this->_engine->addComponent<HitBox>(projectile, HitBox());
-            this->_engine->addComponent<Team>(projectile, isFromPlayable ? TeamType::PLAYER : TeamType::ENEMY);
-            this->_engine->addComponent<AudioSource>(projectile, AudioSource(AudioAssets::SFX_SHOOT_CHARGED, AUDIO_CHARGED_PROJECTILE_LOOP, AUDIO_CHARGED_PROJECTILE_MIN_DISTANCE, AUDIO_CHARGED_PROJECTILE_ATTENUATION, false, AUDIO_SHOOT_CHARGED_DURATION));
+            prefab = &this->_prefabs.get(PrefabId::PROJECTILE_CHARGED);
             break;
 
         // case 0x02: // WEAPON_TYPE_SPREAD
@@ -3296,6 +3473,18 @@ Entity Coordinator::spawnProjectile(Entity shooter, uint32_t projectile_id, uint
             break;
     }
 
+    if (prefab) {
+        LOG_DEBUG_CAT("Coordinator", "spawnProjectile: Applying prefab of weapon type {}", static_cast<int>(weapon_type));
+        this->_engine->applyPrefab(projectile, *prefab, [&](Entity e) {
+            auto& transform = this->_engine->getComponentEntity<Transform>(e);
+            transform->x = origin_x;
+            transform->y = origin_y;
+            this->_engine->getComponentEntity<Velocity>(e) = Velocity(dir_x * projectileSpeed, dir_y * projectileSpeed);
+            this->_engine->getComponentEntity<Projectile>(e) = Projectile(shooter, isFromPlayable, projectileDamage);
+            this->_engine->getComponentEntity<Team>(e) = Team(isFromPlayable ? TeamType::PLAYER : TeamType::ENEMY);
+        });
+        LOG_DEBUG_CAT("Coordinator", "spawnProjectile: All components added successfully");
+    }
 
     return projectile;
 }
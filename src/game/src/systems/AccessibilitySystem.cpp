@@ -9,14 +9,8 @@
 
 void AccessibilitySystem::onUpdate(float dt)
 {
-    auto& configs = this->_engine.getComponents<GameConfig>();
     FontAssets targetFont = FontAssets::DEFAULT_FONT;
 
-    for (auto& config : configs) {
-        if (!config.has_value())
-            continue;
-
+    if (const GameConfig* config = this->_engine.tryGetResource<GameConfig>())
         targetFont = config->activeFont;
-        break;
-    }
 }
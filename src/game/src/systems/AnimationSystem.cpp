@@ -10,22 +10,13 @@
 
 void AnimationSystem::onUpdate(float dt)
 {
-    auto& animations = this->_engine.getComponents<Animation>();
-    auto& sprites = this->_engine.getComponents<Sprite>();
-
     static bool firstRun = true;
     if (firstRun && this->_entities.size() > 0) {
         LOG_INFO_CAT("AnimationSystem", "Processing {} entities", this->_entities.size());
         firstRun = false;
     }
 
-    for (size_t e : this->_entities) {
-        if (!animations[e] || !sprites[e])
-            continue;
-
-        auto& anim = animations[e].value();
-        auto& sprite = sprites[e].value();
-
+    this->_engine.view<Animation, Sprite>().each([dt](size_t e, Animation& anim, Sprite& sprite) {
         anim.elapsedTime += dt;
 
         if (anim.elapsedTime > anim.frameDuration) {
@@ -52,5 +43,5 @@ void AnimationSystem::onUpdate(float dt)
         // LOG_DEBUG_CAT("AnimationSystem", "Entity {} sprite rect=({},{},{}x{}) frame={}/{}",
         //     e, sprite.rect.left, sprite.rect.top, sprite.rect.width, sprite.rect.height,
         //     anim.currentFrame, anim.endFrame);
-    }
+    });
 }
\ No newline at end of file
@@ -46,18 +46,16 @@ void AudioSystem::onUpdate(float dt)
     // Get component arrays
     auto& audioSources = this->_engine.getComponents<AudioSource>();
     auto& transforms = this->_engine.getComponents<Transform>();
-    auto& configs = this->_engine.getComponents<GameConfig>();
 
     bool musicEnabled = true;
     bool soundEnabled = true;
 
-    for (auto& config : configs)
-        if (config.has_value()) {
-            if (config->musicEnabled == false && config->soundEnabled == false)
-                return;
-            musicEnabled = config->musicEnabled;
-            soundEnabled = config->soundEnabled;
-        }
+    if (const GameConfig* config = this->_engine.tryGetResource<GameConfig>()) {
+        if (config->musicEnabled == false && config->soundEnabled == false)
+            return;
+        musicEnabled = config->musicEnabled;
+        soundEnabled = config->soundEnabled;
+    }
 
     // Process entities with AudioSource components
     // These are sounds attached to entities (e.g., projectile sounds)
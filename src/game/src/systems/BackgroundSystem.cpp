@@ -18,20 +18,10 @@ void BackgroundSystem::onUpdate(float dt)
         return;
     }
     
-    auto& transforms = this->_engine.getComponents<Transform>();
-    auto& sprites = this->_engine.getComponents<Sprite>();
-    auto& backgrounds = this->_engine.getComponents<ScrollingBackground>();
-
     float scaleFactor = this->_engine.getScaleFactor();
 
-    for (size_t e : _entities) {
-        if (!transforms[e] || !sprites[e] || !backgrounds[e])
-            continue;
-
-        auto& transform = transforms[e].value();
-        auto& sprite = sprites[e].value();
-        auto& bg = backgrounds[e].value();
-
+    this->_engine.view<Transform, Sprite, ScrollingBackground>().each(
+        [dt, scaleFactor](size_t, Transform& transform, Sprite& sprite, ScrollingBackground& bg) {
         float scrollAmout = bg.scrollSpeed * scaleFactor * dt;
 
         if (bg.horizontal) {
@@ -59,6 +49,5 @@ void BackgroundSystem::onUpdate(float dt)
 
             transform.y = bg.currentOffset;
         }
-
-    }
+    });
 }
\ No newline at end of file
@@ -8,178 +8,169 @@
 #include <game/systems/CollisionSystem.hpp>
 #include <engine/ecs/component/Components.hpp>
 #include <engine/ecs/entity/Entity.hpp>
-#include <game/systems/ScoreSystem.hpp>
-#include <iostream>
+#include <engine/core/FrameArena.hpp>
 
-bool CollisionSystem::checkAABBCollision(const Sprite& s1, const Sprite& s2)
+#include <algorithm>
+#include <tuple>
+
+const CollisionSystem::Rules& CollisionSystem::rules()
 {
-    // If globalBounds are not set (e.g., on server), we can't check collision
-    if (s1.globalBounds.width == 0 || s1.globalBounds.height == 0 ||
-        s2.globalBounds.width == 0 || s2.globalBounds.height == 0) {
-        return false;
-    }
-    return s1.globalBounds.intersects(s2.globalBounds);
+    static const Rules table = [] {
+        Rules built;
+        for (size_t a = 0; a < engine::physics::LayerMatrix::LAYERS; ++a) {
+            for (size_t b = 0; b < engine::physics::LayerMatrix::LAYERS; ++b) {
+                LayerRule rule = ruleOf(static_cast<std::uint8_t>(a), static_cast<std::uint8_t>(b));
+                built.rules[a * engine::physics::LayerMatrix::LAYERS + b] = rule;
+                if (rule.interacts)
+                    built.matrix.set(static_cast<std::uint8_t>(a), static_cast<std::uint8_t>(b));
+            }
+        }
+        return built;
+    }();
+    return table;
 }
 
-void CollisionSystem::updateGlobalBounds(Sprite& sprite, const Transform& transform)
+std::uint8_t CollisionSystem::layerOf(const Team* team, bool isProjectile)
 {
-    // Manually calculate globalBounds from sprite rect and transform
-    // This is needed on the server where RenderSystem doesn't run
-    float width = sprite.rect.width * transform.scale;
-    float height = sprite.rect.height * transform.scale;
-    sprite.globalBounds = sf::FloatRect(transform.x, transform.y, width, height);
+    std::uint8_t mask = team ? team->teamMask : static_cast<std::uint8_t>(TeamType::NEUTRAL);
+    return static_cast<std::uint8_t>((mask & TEAM_LAYER_BITS) | (isProjectile ? PROJECTILE_LAYER_BIT : 0));
 }
 
-void CollisionSystem::onUpdate(float dt)
+CollisionSystem::LayerRule CollisionSystem::ruleOf(std::uint8_t layer1, std::uint8_t layer2)
 {
-    auto& transforms = this->_engine.getComponents<Transform>();
-    auto& sprites = this->_engine.getComponents<Sprite>();
-    auto& healths = this->_engine.getComponents<Health>();
-    auto& hitboxes = this->_engine.getComponents<HitBox>();
-    auto& projectiles = this->_engine.getComponents<Projectile>();
-    auto& teams = this->_engine.getComponents<Team>();
-
-    std::vector<size_t> entities;
-    entities.reserve(this->_entities.size());
-    for (size_t entity : this->_entities) {
-        entities.push_back(entity);
+    bool p1 = (layer1 & PROJECTILE_LAYER_BIT) != 0;
+    bool p2 = (layer2 & PROJECTILE_LAYER_BIT) != 0;
+    Team e1Team(static_cast<std::uint8_t>(layer1 & TEAM_LAYER_BITS));
+    Team e2Team(static_cast<std::uint8_t>(layer2 & TEAM_LAYER_BITS));
+
+    // Projectiles never hit each other
+    if (p1 && p2)
+        return {};
+
+    // Handle projectile collisions with team rules
+    if (p1 || p2) {
+        if (!Team::canCollide(p1 ? e1Team : e2Team, p1 ? e2Team : e1Team, true))
+            return {};
+        return {true, CollisionKind::PROJECTILE_HIT, p2};
     }
 
-    // Update globalBounds for all entities (needed on server where RenderSystem doesn't run)
-    for (size_t e : entities) {
-        if (transforms[e] && sprites[e]) {
-            auto& sprite = sprites[e].value();
-            auto& transform = transforms[e].value();
-            updateGlobalBounds(sprite, transform);
-        }
-    }
-
-    for (size_t i = 0; i < entities.size(); ++i) {
-        size_t e1 = entities[i];
-
-        if (!transforms[e1] || !sprites[e1] || !hitboxes[e1])
-            continue;
+    // If one entity is OBSTACLE, no damage is applied at all
+    if (e1Team.hasTeam(TeamType::OBSTACLE) || e2Team.hasTeam(TeamType::OBSTACLE))
+        return {};
+
+    bool e1IsPlayer = e1Team.hasTeam(TeamType::PLAYER);
+    bool e2IsPlayer = e2Team.hasTeam(TeamType::PLAYER);
+    bool e1IsEnemy = e1Team.hasTeam(TeamType::ENEMY) || e1Team.hasTeam(TeamType::BOSS);
+    bool e2IsEnemy = e2Team.hasTeam(TeamType::ENEMY) || e2Team.hasTeam(TeamType::BOSS);
+    if (e1IsPlayer && e2IsEnemy)
+        return {true, CollisionKind::CONTACT, false};
+    if (e1IsEnemy && e2IsPlayer)
+        return {true, CollisionKind::CONTACT, true};
+    return {};
+}
 
-        auto& t1 = transforms[e1].value();
-        auto& s1 = sprites[e1].value();
-
-        for (size_t j = i + 1; j < entities.size(); ++j) {
-            size_t e2 = entities[j];
-
-            if (!transforms[e2] || !sprites[e2] || !hitboxes[e2])
-                continue;
-
-            auto& t2 = transforms[e2].value();
-            auto& s2 = sprites[e2].value();
-
-            if (!checkAABBCollision(s1, s2))
-                continue;
-
-            bool e1Projectile = e1 < projectiles.size() && projectiles[e1].has_value();
-            bool e2Projectile = e2 < projectiles.size() && projectiles[e2].has_value();
-
-            // Get team components (default to NEUTRAL if not present)
-            Team e1Team = e1 < teams.size() && teams[e1] ? teams[e1].value() : Team(TeamType::NEUTRAL);
-            Team e2Team = e2 < teams.size() && teams[e2] ? teams[e2].value() : Team(TeamType::NEUTRAL);
-
-            auto applyDamage = [&](size_t target, int damage, const Team& sourceTeam) {
-                if (target >= healths.size() || !healths[target])
-                    return;
-
-                Team targetTeam = (target < teams.size() && teams[target]) ? teams[target].value()
-                                                                        : Team(TeamType::NEUTRAL);
-
-                // PLAYER hit => score -10, mais PAS de dégâts HP
-                if (damage > 0 && targetTeam.hasTeam(TeamType::PLAYER)) {
-                    _engine.getSystem<ScoreSystem>().pushEvent(-10);
-                    return; // stop ici: pas de réduction de HP, pas de mort
-                }
-
-                // Non-player: dégâts normaux
-                auto& h = healths[target].value();
-                h.currentHealth -= damage;
-
-                if (h.currentHealth <= 0) {
-                    // PLAYER kills ENEMY/BOSS => +100
-                    const bool targetIsEnemy = targetTeam.hasTeam(TeamType::ENEMY) || targetTeam.hasTeam(TeamType::BOSS);
-                    const bool sourceIsPlayer = sourceTeam.hasTeam(TeamType::PLAYER);
-                    if (targetIsEnemy && sourceIsPlayer) {
-                        _engine.getSystem<ScoreSystem>().pushEvent(100);
-                    }
-
-                    Entity ent = Entity::fromId(target);
-                    this->_engine.removeComponent<Transform>(ent);
-                    this->_engine.removeComponent<Sprite>(ent);
-                    this->_engine.removeComponent<Health>(ent);
-                    this->_engine.removeComponent<HitBox>(ent);
-                    if (target < teams.size() && teams[target]) {
-                        this->_engine.removeComponent<Team>(ent);
-                    }
-                }
-            };
-
-            auto destroyProjectile = [&](size_t projId) {
-                Entity ent = Entity::fromId(projId);
-                this->_engine.removeComponent<Transform>(ent);
-                this->_engine.removeComponent<Sprite>(ent);
-                this->_engine.removeComponent<HitBox>(ent);
-                this->_engine.removeComponent<Projectile>(ent);
-                if (projId < teams.size() && teams[projId]) {
-                    this->_engine.removeComponent<Team>(ent);
-                }
-            };
-
-            // Handle projectile collisions with team rules
-            if (e1Projectile && !e2Projectile) {
-                if (!Team::canCollide(e1Team, e2Team, true)) {
-                    continue;
-                }
-
-                const auto& proj = projectiles[e1].value();
-                if (e2 == static_cast<size_t>(proj.shooterId)) {
-                    continue;
-                }
-
-                applyDamage(e2, proj.damage, e1Team);
-                destroyProjectile(e1);
-                continue;
-            }
+std::optional<CollisionEvent> CollisionSystem::classify(std::uint32_t e1, std::uint8_t layer1,
+    std::uint32_t e2, std::uint8_t layer2, const ComponentManager<Projectile>& projectiles)
+{
+    const LayerRule& rule = rules().rules[layer1 * engine::physics::LayerMatrix::LAYERS + layer2];
+    if (!rule.interacts)
+        return std::nullopt;
+    std::uint32_t a = rule.swapped ? e2 : e1;
+    std::uint32_t b = rule.swapped ? e1 : e2;
+
+    // The shooter is never hit by its own projectile
+    if (rule.kind == CollisionKind::PROJECTILE_HIT) {
+        const Projectile* projectile = projectiles.tryGet(a);
+        if (!projectile || b == static_cast<std::uint32_t>(static_cast<size_t>(projectile->shooterId)))
+            return std::nullopt;
+    }
+    return CollisionEvent{a, b, rule.kind};
+}
 
-            if (e2Projectile && !e1Projectile) {
-                // Check if projectile can hit target based on teams
-                if (!Team::canCollide(e2Team, e1Team, true)) {
-                    continue;
-                }
+void CollisionSystem::addCollider(size_t entity, std::uint8_t layer, const Transform& transform,
+    const HitBox& hitBox, const Sprite* sprite, const Velocity* sweep, float dt)
+{
+    if (!placeCollider(entity, layer, transform, hitBox, sprite) || !sweep)
+        return;
+    // MovementSystem already moved it by vel * dt this tick
+    this->_colliders.move(this->_colliders.size() - 1, sweep->vx * dt, sweep->vy * dt);
+}
 
-                const auto& proj = projectiles[e2].value();
-                if (e1 == static_cast<size_t>(proj.shooterId)) {
-                    continue;
-                }
+bool CollisionSystem::placeCollider(size_t entity, std::uint8_t layer, const Transform& transform,
+    const HitBox& hitBox, const Sprite* sprite)
+{
+    std::uint32_t id = static_cast<std::uint32_t>(entity);
+    float x = transform.x + hitBox.offsetX * transform.scale;
+    float y = transform.y + hitBox.offsetY * transform.scale;
+
+    if (hitBox.shape == HitBoxShape::CIRCLE)
+        return this->_colliders.add(id, engine::physics::Circle{x, y, hitBox.radius * transform.scale}, layer);
+    float width = hitBox.width;
+    float height = hitBox.height;
+    if ((width == 0.f || height == 0.f) && sprite) {
+        width = static_cast<float>(sprite->rect.width);
+        height = static_cast<float>(sprite->rect.height);
+    }
+    return this->_colliders.add(id, engine::physics::AABB{x, y, width * transform.scale, height * transform.scale}, layer);
+}
 
-                applyDamage(e1, proj.damage, e2Team);
-                destroyProjectile(e2);
-                continue;
-            }
+void CollisionSystem::onUpdate(float dt)
+{
+    CollisionEvents& events = this->_engine.getResource<CollisionEvents>();
+    events.collisions.clear();
+    events.hits.clear();
 
-            // If one entity is OBSTACLE, no damage is applied at all
-            bool e1IsObstacle = e1Team.hasTeam(TeamType::OBSTACLE);
-            bool e2IsObstacle = e2Team.hasTeam(TeamType::OBSTACLE);
-
-            if (!e1IsObstacle && !e2IsObstacle) {
-                bool e1IsPlayer = e1Team.hasTeam(TeamType::PLAYER);
-                bool e2IsPlayer = e2Team.hasTeam(TeamType::PLAYER);
-                bool e1IsEnemy = e1Team.hasTeam(TeamType::ENEMY) || e1Team.hasTeam(TeamType::BOSS);
-                bool e2IsEnemy = e2Team.hasTeam(TeamType::ENEMY) || e2Team.hasTeam(TeamType::BOSS);
-
-                if ((e1IsPlayer && e2IsEnemy) || (e1IsEnemy && e2IsPlayer)) {
-                    if (e1IsPlayer && e2 < healths.size() && healths[e2]) {
-                        applyDamage(e2, 10, e1Team);
-                    }
-                    if (e2IsPlayer && e1 < healths.size() && healths[e1]) {
-                        applyDamage(e1, 10, e2Team);
-                    }
-                }
-            }
+    auto& sprites = this->_engine.getComponents<Sprite>();
+    const auto& projectiles = this->_engine.getComponents<Projectile>();
+    const auto& teams = this->_engine.getComponents<Team>();
+    const auto& velocities = this->_engine.getComponents<Velocity>();
+    this->_colliders.clear();
+    this->_engine.view<Transform, HitBox>().each(
+        [&](size_t e, Transform& transform, HitBox& hitBox) {
+            // Projectiles are swept along their motion of the tick, so they cannot skip a thin target
+            bool isProjectile = projectiles.contains(e);
+            addCollider(e, layerOf(teams.tryGet(e), isProjectile), transform, hitBox, sprites.tryGet(e),
+                isProjectile ? velocities.tryGet(e) : nullptr, dt);
+        });
+
+    // Broad phase: only the colliders sharing a grid cell, on layers that interact, are tested
+    const engine::physics::ColliderStore& colliders = this->_colliders;
+    this->_grid.clear();
+    for (std::uint32_t i = 0; i < colliders.size(); ++i) {
+        this->_grid.insert(i, colliders.minX[i], colliders.minY[i], colliders.maxX[i], colliders.maxY[i],
+            colliders.layer[i]);
+    }
+    this->_grid.build();
+
+    std::pmr::vector<std::uint32_t> first(&FrameArena::local());
+    std::pmr::vector<std::uint32_t> second(&FrameArena::local());
+    this->_grid.forEachPair([&](std::uint32_t i, std::uint32_t j) {
+        first.push_back(i);
+        second.push_back(j);
+    });
+
+    // Narrow phase: every candidate pair in one batch
+    std::pmr::vector<std::uint8_t> hits(first.size(), &FrameArena::local());
+    std::pmr::vector<float> times(first.size(), &FrameArena::local());
+    engine::physics::Collision::checkPairs(colliders, first.data(), second.data(), first.size(), hits.data(),
+        times.data());
+
+    for (size_t k = 0; k < hits.size(); ++k) {
+        if (!hits[k])
+            continue;
+        std::optional<CollisionEvent> event = classify(colliders.owner[first[k]], colliders.layer[first[k]],
+            colliders.owner[second[k]], colliders.layer[second[k]], projectiles);
+        if (event) {
+            event->time = times[k];
+            events.collisions.push_back(*event);
         }
     }
+
+    // A projectile crossing several targets this tick is spent by the first one on its path.
+    // Total order, so std::sort (no temporary buffer, unlike std::stable_sort) stays deterministic
+    auto earlier = [](const CollisionEvent& lhs, const CollisionEvent& rhs) {
+        return std::tie(lhs.time, lhs.a, lhs.b, lhs.kind) < std::tie(rhs.time, rhs.a, rhs.b, rhs.kind);
+    };
+    if (!std::is_sorted(events.collisions.begin(), events.collisions.end(), earlier))
+        std::sort(events.collisions.begin(), events.collisions.end(), earlier);
 }
@@ -0,0 +1,67 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** DamageSystem
+*/
+
+#include <game/systems/DamageSystem.hpp>
+
+void DamageSystem::onUpdate(float)
+{
+    CollisionEvents* events = this->_engine.tryGetResource<CollisionEvents>();
+    if (!events)
+        return;
+    auto& projectiles = this->_engine.getComponents<Projectile>();
+
+    this->_removed.clear();
+    for (const CollisionEvent& collision : events->collisions) {
+        if (this->_removed.contains(collision.a) || this->_removed.contains(collision.b))
+            continue;
+
+        if (collision.kind == CollisionKind::PROJECTILE_HIT) {
+            const Projectile* projectile = projectiles.tryGet(collision.a);
+            if (!projectile)
+                continue;
+            if (hit(*events, collision.b, collision.a, collision.kind, projectile->damage))
+                this->_removed.insert(collision.b);
+            this->_removed.insert(collision.a);
+        } else if (hit(*events, collision.b, collision.a, collision.kind, CONTACT_DAMAGE)) {
+            this->_removed.insert(collision.b);
+        }
+    }
+}
+
+bool DamageSystem::hit(CollisionEvents& events, std::uint32_t target, std::uint32_t source,
+    CollisionKind kind, int32_t damage)
+{
+    auto& healths = this->_engine.getComponents<Health>();
+    auto& teams = this->_engine.getComponents<Team>();
+    auto& transforms = this->_engine.getComponents<Transform>();
+
+    Health* health = healths.tryGet(target);
+    // Only a spent projectile matters when the target cannot take damage
+    if (!health && kind != CollisionKind::PROJECTILE_HIT)
+        return false;
+
+    const Transform* transform = transforms.tryGet(target);
+    HitEvent event{target, source, kind, damage, false, false, false,
+        transform ? transform->x : 0.f, transform ? transform->y : 0.f};
+
+    const Team* team = teams.tryGet(target);
+    Team targetTeam = team ? *team : Team(TeamType::NEUTRAL);
+    if (health && damage > 0 && targetTeam.hasTeam(TeamType::PLAYER)) {
+        event.playerHit = true;
+    } else if (health) {
+        health->currentHealth -= damage;
+        healths.markChanged(target);
+        if (health->currentHealth <= 0) {
+            const Team* sourceTeam = teams.tryGet(source);
+            event.killed = true;
+            event.bounty = (targetTeam.hasTeam(TeamType::ENEMY) || targetTeam.hasTeam(TeamType::BOSS))
+                && sourceTeam && sourceTeam->hasTeam(TeamType::PLAYER);
+        }
+    }
+    events.hits.push_back(event);
+    return event.killed;
+}
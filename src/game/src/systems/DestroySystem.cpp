@@ -8,6 +8,7 @@
 #include <common/logger/Logger.hpp>
 #include <common/error/Error.hpp>
 #include <game/systems/DestroySystem.hpp>
+#include <engine/core/FrameArena.hpp>
 
 constexpr float DESTROY_MARGIN_X = 2000.0f;
 constexpr float DESTROY_MARGIN_Y = 2000.0f;
@@ -16,7 +17,7 @@ void DestroySystem::onUpdate(float dt)
 {
     try {
         auto& transforms = this->_engine.getComponents<Transform>();
-        std::vector<size_t> entitiesToDestroy;
+        std::pmr::vector<size_t> entitiesToDestroy(&FrameArena::local());
         
         // Calculer les limites réelles de destruction
         // À gauche : -1000 (1000px avant le bord gauche à x=0)
@@ -63,16 +64,27 @@ void DestroySystem::onUpdate(float dt)
             }
         }
         
-        // Détruire toutes les entités marquées
+        // Détruire toutes les entités marquées (appliqué au prochain sync point)
+        auto& commands = this->_engine.getCommandBuffer();
         for (size_t e : entitiesToDestroy) {
-            this->_engine.destroyEntity(e);
+            commands.kill(this->_engine.getEntityFromId(e));
             LOG_INFO_CAT("DestroySystem", "Entity {} destroyed", e);
         }
         
         if (!entitiesToDestroy.empty()) {
             LOG_DEBUG_CAT("DestroySystem", "Destroyed {} entities this frame", entitiesToDestroy.size());
         }
-        
+
+        // Strip the projectiles spent and the targets killed by this tick's hits
+        if (const CollisionEvents* collisions = this->_engine.tryGetResource<CollisionEvents>()) {
+            for (const HitEvent& hit : collisions->hits) {
+                if (hit.kind == CollisionKind::PROJECTILE_HIT)
+                    commands.remove<Transform, Sprite, HitBox, Projectile, Team>(Entity::fromId(hit.source));
+                if (hit.killed)
+                    commands.remove<Transform, Sprite, Health, HitBox, Team>(Entity::fromId(hit.target));
+            }
+        }
+
     } catch (const Error& e) {
         LOG_ERROR_CAT("DestroySystem", "Error in DestroySystem::onUpdate: {}", e.what());
         throw;
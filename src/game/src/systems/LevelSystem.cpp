@@ -144,38 +144,13 @@ Entity LevelSystem::createEnemyByType(EnemyType type, float x, float y)
     // Get next NETWORKED entity ID (enemies must be synchronized over network)
     uint32_t enemyId = this->_engine.getNextNetworkedEntityId();
 
-    // Determine enemy stats based on type
-    uint16_t health = BASE_ENEMY_HEALTH_START;
-    float velX = BASE_ENEMY_VELOCITY_X;
-    float velY = BASE_ENEMY_VELOCITY_Y;
-
-    switch (type)
-    {
-    case EnemyType::BASIC:
-        health = BASE_ENEMY_HEALTH_START;
-        velX = BASE_ENEMY_VELOCITY_X;
-        velY = BASE_ENEMY_VELOCITY_Y;
-        break;
-
-        case EnemyType::FAST:
-        health = FAST_ENEMY_HEALTH;
-        velX = FAST_ENEMY_VELOCITY_X;
-        velY = FAST_ENEMY_VELOCITY_Y;
-        break;
-
-        case EnemyType::TANK:
-        health = TANK_ENEMY_HEALTH;
-        velX = TANK_ENEMY_VELOCITY_X;
-        velY = TANK_ENEMY_VELOCITY_Y;
-        break;
-
-        case EnemyType::BOSS:
-        // TODO: Implement boss stats
-        break;
-
-        default:
-        break;
-    }
+    // Default stats of the type come from its prefab (built once by the Coordinator)
+    const Prefab& prefab = this->_coordinator->getEnemyPrefab(type);
+    const Velocity* velocity = prefab.get<Velocity>();
+    const Health* stats = prefab.get<Health>();
+    uint16_t health = static_cast<uint16_t>(stats->maxHp);
+    float velX = velocity->vx;
+    float velY = velocity->vy;
 
     // Use Coordinator to create enemy with proper network ID
     // All enemy-specific components (scale, Weapon, AI) are now set in setupEnemyEntity based on type
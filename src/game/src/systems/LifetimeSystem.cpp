@@ -20,7 +20,7 @@ void LifetimeSystem::onUpdate(float deltaTime) {
         lifetime.remainingTime -= deltaTime;
 
         if (lifetime.remainingTime <= 0.0f) {
-            this->_engine.destroyEntity(e);
+            this->_engine.getCommandBuffer().kill(this->_engine.getEntityFromId(e));
         }
     }
 }
@@ -23,21 +23,15 @@ void RenderSystem::onUpdate(float dt)
     auto& texts = this->_engine.getComponents<Text>();
     auto& transforms = this->_engine.getComponents<Transform>();
 
-    // Add entities that have Transform + Text but not Sprite (pure text entities like button labels)
-    for (size_t i = 0; i < texts.size(); ++i) {
-        if (texts[i] && transforms[i] && !sprites[i]) {
-            // Check if this entity is not already in _sortedEntities
-            if (std::find(this->_sortedEntities.begin(), this->_sortedEntities.end(), i) == this->_sortedEntities.end()) {
-                this->_sortedEntities.push_back(i);
-            }
-        }
-    }
-
-    auto& configs = this->_engine.getComponents<GameConfig>();
-    for (auto& config : configs) {
-        if (config.has_value())
-            this->_targetFont = config->activeFont;
-    }
+    // Add entities that have Transform + Text but not Sprite (pure text entities like button labels).
+    // Those with a Sprite are already in _entities.
+    this->_engine.view<Transform, Text>().each([this, &sprites](size_t e, Transform&, Text&) {
+        if (!sprites.contains(e))
+            this->_sortedEntities.push_back(e);
+    });
+
+    if (const GameConfig* config = this->_engine.tryGetResource<GameConfig>())
+        this->_targetFont = config->activeFont;
 
     // we need to sort here cuz Z = 0 (background) and Z = 1 (player) and Z = 2 (HUD/UI), to display in the right order
     std::sort(this->_sortedEntities.begin(), this->_sortedEntities.end(),
@@ -6,35 +6,42 @@
 
 void ScoreSystem::onUpdate(float)
 {
-    auto& scores = _engine.getComponents<Score>();
-    auto& texts  = _engine.getComponents<Text>();
-    auto& events = _engine.scoreEvents();
-
-    const size_t hud = static_cast<size_t>(_hud);
-
-    if (hud >= scores.size() || !scores[hud]) {
-        events.clear();
+    ScoreBoard* board = _engine.tryGetResource<ScoreBoard>();
+    if (!board)
         return;
-    }
-
-    auto& s = scores[hud].value().score; // uint32_t
-
-    for (const auto& ev : events) {
-        const int32_t delta = ev.amount;
 
+    auto& s = board->score; // uint32_t
+    auto apply = [&s](int32_t delta) {
         if (delta >= 0) {
             s += static_cast<uint32_t>(delta);
         } else {
             const uint32_t dec = static_cast<uint32_t>(-delta);
             s = (s > dec) ? (s - dec) : 0u;
         }
+    };
+
+    // Hits of the tick first, in the order DamageSystem resolved them
+    if (const CollisionEvents* collisions = _engine.tryGetResource<CollisionEvents>()) {
+        for (const HitEvent& hit : collisions->hits) {
+            if (hit.playerHit)
+                apply(-PLAYER_HIT_PENALTY);
+            if (hit.bounty)
+                apply(KILL_BONUS);
+        }
     }
+    for (const int32_t delta : board->events)
+        apply(delta);
+    board->events.clear();
 
-    if (hud < texts.size() && texts[hud]) {
-        std::snprintf(texts[hud].value().str, sizeof(texts[hud].value().str),
-                      "%u", s);
-    }
+    const Entity hud = board->hud;
+    if (static_cast<size_t>(hud) == 0 || !_engine.isAlive(hud))
+        return;
 
-    events.clear();
-}
+    auto& score = _engine.getComponentEntity<Score>(hud);
+    if (score)
+        score->score = s;
 
+    auto& text = _engine.getComponentEntity<Text>(hud);
+    if (text)
+        std::snprintf(text->str, sizeof(text->str), "%u", s);
+}
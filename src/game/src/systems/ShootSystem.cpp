@@ -23,30 +23,22 @@ void ShootSystem::onUpdate(float dt)
     auto duration = now.time_since_epoch();
     uint64_t currentTime = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
 
-    auto& weapons = this->_engine.getComponents<Weapon>();
-    auto& transforms = this->_engine.getComponents<Transform>();
     auto& inputs = this->_engine.getComponents<InputComponent>();
 
     // Process each entity with a weapon
-    for (size_t e : this->_entities) {
-        if (!weapons[e] || !transforms[e])
-            continue;
-
-        auto& weapon = weapons[e].value();
-        auto& transform = transforms[e].value();
-        
+    this->_engine.view<Weapon, Transform>().each([&](size_t e, Weapon& weapon, Transform& transform) {
         // Check if entity has InputComponent (is a player)
-        bool isPlayer = inputs[e].has_value();
+        InputComponent* input = inputs.tryGet(e);
+        bool isPlayer = input != nullptr;
 
         // Check if the entity wants to shoot
         bool shouldShoot = false;
 
         if (isPlayer) {
             // Player entity shoots when shoot action is held from InputComponent
-            auto& input = inputs[e].value();
-            shouldShoot = input.activeActions[GameAction::SHOOT];
+            shouldShoot = input->activeActions[GameAction::SHOOT];
             if (shouldShoot) {
-                std::cout << "[ShootSystem] SHOOT detected for player " << input.playerId << std::endl;
+                std::cout << "[ShootSystem] SHOOT detected for player " << input->playerId << std::endl;
             }
         } else {
             // Non-player entities (enemies) always want to shoot
@@ -66,7 +58,7 @@ void ShootSystem::onUpdate(float dt)
                 if (isPlayer) {
                     std::cout << "[ShootSystem] CLIENT: Shooting detected, waiting for server response..." << std::endl;
                 }
-                continue;
+                return;
             }
             
             // SERVER ONLY: Queue the weapon fire event
@@ -85,25 +77,28 @@ void ShootSystem::onUpdate(float dt)
             float shootPosX = transform.x;
             float shootPosY = transform.y;
             if (isPlayer) {
-                auto& input = inputs[e].value();
                 // Use client position if valid (non-zero), otherwise fallback to server position
-                if (input.clientPosX != 0.0f || input.clientPosY != 0.0f) {
-                    shootPosX = input.clientPosX;
-                    shootPosY = input.clientPosY;
+                if (input->clientPosX != 0.0f || input->clientPosY != 0.0f) {
+                    shootPosX = input->clientPosX;
+                    shootPosY = input->clientPosY;
                     std::cout << "[ShootSystem] Using client position (" << shootPosX << ", " << shootPosY 
                               << ") instead of server position (" << transform.x << ", " << transform.y << ")" << std::endl;
                 }
             }
             
             // Queue the weapon fire event to be processed by Coordinator
+            // (it spawns the projectile right away, which may move packed components:
+            // do not touch transform/weapon/input past this call)
+            float serverPosX = transform.x;
+            float serverPosY = transform.y;
             _coordinator.queueWeaponFire(shooterId, shootPosX, shootPosY, dirX, dirY, weaponType);
             
             if (isPlayer) {
                 std::cout << "[ShootSystem] Weapon fire queued from player " << shooterId 
-                          << " at (" << transform.x << ", " << transform.y << ")" << std::endl;
+                          << " at (" << serverPosX << ", " << serverPosY << ")" << std::endl;
             }
         }
-    }
+    });
 }
 
 void ShootSystem::spawnProjectile(Entity shooterId, float originX, float originY,
@@ -176,15 +176,12 @@ std::string getKeybordKeyFromGameConfig(gameEngine::GameEngine& engine, GameActi
 {
     sf::Keyboard::Key key = sf::Keyboard::Unknown;
 
-    auto& configs = engine.getComponents<GameConfig>();
-    for (auto& config : configs) {
-        if (config.has_value())
-            for (auto& k : config->_keybinds)
-                if (k.second == action) {
-                    key = k.first;
-                    break;
-                }
-    }
+    if (const GameConfig* config = engine.tryGetResource<GameConfig>())
+        for (auto& k : config->_keybinds)
+            if (k.second == action) {
+                key = k.first;
+                break;
+            }
 
     return keyToString(key);
 }
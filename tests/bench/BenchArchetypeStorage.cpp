@@ -0,0 +1,170 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** BenchArchetypeStorage
+*/
+
+// Storage mode benchmarks of rtype_bench: bullet-hell frames on the sparse-set
+// and the archetype (chunked SoA) storage. Arguments are the storage mode
+// (0 = sparse set, 1 = archetype) and the workload (see WORKLOADS).
+
+#include <benchmark/benchmark.h>
+
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/component/Components.hpp>
+
+#include <deque>
+#include <string>
+
+namespace {
+
+class MovementBench : public System {};
+class CollisionBench : public System {};
+
+constexpr size_t ENEMIES = 300;             /**< Enemies of the running wave */
+
+/**
+ * @brief Bullet-hell frame: spawn a burst of projectiles, move everything, refresh bounds, expire the oldest shots.
+ */
+struct Workload {
+    const char* name;
+    size_t projectilesPerFrame;
+    size_t aliveProjectiles;
+};
+
+constexpr Workload WORKLOADS[] = {
+    {"wave", 60, 1500},
+    {"barrage", 200, 5000},
+    {"bullet-hell", 500, 15000},
+};
+
+void spawnEnemy(EntityManager& em, size_t i)
+{
+    Entity e = em.spawnEntity("enemy");
+    em.emplaceComponent<Transform>(e, static_cast<float>(i % 40) * 20.f, static_cast<float>(i / 40) * 20.f, 0.f, 1.f);
+    em.emplaceComponent<Velocity>(e, -1.f, 0.f);
+    em.emplaceComponent<Sprite>(e, Assets::BASE_ENEMY, ZIndex::IS_GAME, sf::Rect<int>(0, 0, 32, 32));
+    em.emplaceComponent<HitBox>(e);
+    em.emplaceComponent<Health>(e, 10, 10);
+    em.emplaceComponent<Team>(e, TeamType::ENEMY);
+}
+
+Entity spawnProjectile(EntityManager& em, size_t i)
+{
+    Entity e = em.spawnEntity("projectile");
+    em.emplaceComponent<Transform>(e, 0.f, static_cast<float>(i % 600), 0.f, 1.f);
+    em.emplaceComponent<Velocity>(e, 8.f, 0.f);
+    em.emplaceComponent<Sprite>(e, Assets::DEFAULT_BULLET, ZIndex::IS_GAME, sf::Rect<int>(0, 0, 8, 4));
+    em.emplaceComponent<HitBox>(e);
+    em.emplaceComponent<Projectile>(e, Entity::fromId(1), true, 1);
+    em.emplaceComponent<Team>(e, TeamType::PLAYER);
+    return e;
+}
+
+void runFrame(EntityManager& em)
+{
+    em.view<Transform, Velocity>().each([](size_t, Transform& t, Velocity& v) {
+        t.x += v.vx;
+        t.y += v.vy;
+    });
+    em.view<Transform, Sprite, HitBox>().each([](size_t, Transform& t, Sprite& s, HitBox&) {
+        s.globalBounds = sf::FloatRect(t.x, t.y, s.rect.width * t.scale, s.rect.height * t.scale);
+    });
+}
+
+/**
+ * @brief A world of one storage mode running a workload, with its projectiles in spawn order.
+ */
+struct BulletHellWorld {
+    EntityManager em;
+    SystemManager sm;
+    const Workload& workload;
+    std::deque<Entity> alive;
+    size_t spawned = 0;
+
+    BulletHellWorld(StorageMode mode, const Workload& load) : em(mode), workload(load)
+    {
+        em.setSystemManager(&sm);
+        em.registerComponent<Transform>();
+        em.registerComponent<Velocity>();
+        em.registerComponent<Sprite>();
+        em.registerComponent<HitBox>();
+        em.registerComponent<Health>();
+        em.registerComponent<Projectile>();
+        em.registerComponent<Team>();
+
+        sm.addSystem<MovementBench>();
+        sm.addSystem<CollisionBench>();
+        Signature movement;
+        movement.set(em.getComponentTypeId<Transform>());
+        movement.set(em.getComponentTypeId<Velocity>());
+        sm.setSignature<MovementBench>(movement);
+        Signature collision;
+        collision.set(em.getComponentTypeId<Transform>());
+        collision.set(em.getComponentTypeId<Sprite>());
+        collision.set(em.getComponentTypeId<HitBox>());
+        sm.setSignature<CollisionBench>(collision);
+
+        for (size_t i = 0; i < ENEMIES; ++i)
+            spawnEnemy(em, i);
+    }
+
+    /**
+     * @brief Spawns the frame's burst and kills the projectiles past the workload's cap.
+     */
+    void churn()
+    {
+        for (size_t i = 0; i < workload.projectilesPerFrame; ++i)
+            alive.push_back(spawnProjectile(em, spawned++));
+        while (alive.size() > workload.aliveProjectiles) {
+            em.killEntity(alive.front());
+            alive.pop_front();
+        }
+    }
+};
+
+StorageMode modeOf(const benchmark::State& state)
+{
+    return state.range(0) == 1 ? StorageMode::ARCHETYPE : StorageMode::SPARSE_SET;
+}
+
+void label(benchmark::State& state, const Workload& workload)
+{
+    state.SetLabel(std::string(workload.name) + (state.range(0) == 1 ? "/archetype" : "/sparse"));
+}
+
+void BM_StorageSpawnKill(benchmark::State& state)
+{
+    const Workload& workload = WORKLOADS[state.range(1)];
+    BulletHellWorld world(modeOf(state), workload);
+
+    for (auto _ : state)
+        world.churn();
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(workload.projectilesPerFrame));
+    label(state, workload);
+}
+
+void BM_StorageIterate(benchmark::State& state)
+{
+    const Workload& workload = WORKLOADS[state.range(1)];
+    BulletHellWorld world(modeOf(state), workload);
+    // Reach the steady number of live projectiles
+    while (world.spawned < workload.aliveProjectiles)
+        world.churn();
+
+    for (auto _ : state) {
+        runFrame(world.em);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(world.alive.size() + ENEMIES));
+    label(state, workload);
+}
+
+#define STORAGE_WORKLOADS ArgsProduct({{0, 1}, {0, 1, 2}})
+
+BENCHMARK(BM_StorageSpawnKill)->STORAGE_WORKLOADS;
+BENCHMARK(BM_StorageIterate)->STORAGE_WORKLOADS;
+
+} // namespace
@@ -0,0 +1,176 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** BenchCollision
+*/
+
+// Collision benchmarks of rtype_bench: the broad phase alone (all pairs
+// against the uniform grid) and a full CollisionSystem pass.
+
+#include <benchmark/benchmark.h>
+
+#include <engine/GameEngine.hpp>
+#include <engine/physics/SpatialGrid.hpp>
+#include <game/systems/CollisionSystem.hpp>
+#include <game/systems/ScoreSystem.hpp>
+#include <common/constants/defines.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr float COLLIDER_SIZE = 32.f;   /**< About a basic enemy sprite */
+
+struct Box {
+    float left, top, right, bottom;
+};
+
+/**
+ * @brief Scatters `count` boxes over the play field, always the same ones.
+ */
+std::vector<Box> scatter(int64_t count)
+{
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> x(0.f, WINDOW_WIDTH - COLLIDER_SIZE);
+    std::uniform_real_distribution<float> y(0.f, WINDOW_HEIGHT - COLLIDER_SIZE);
+    std::vector<Box> boxes;
+    boxes.reserve(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i) {
+        float left = x(rng);
+        float top = y(rng);
+        boxes.push_back({left, top, left + COLLIDER_SIZE, top + COLLIDER_SIZE});
+    }
+    return boxes;
+}
+
+bool overlap(const Box& a, const Box& b)
+{
+    return a.left < b.right && b.left < a.right && a.top < b.bottom && b.top < a.bottom;
+}
+
+void BM_BroadPhaseAllPairs(benchmark::State& state)
+{
+    std::vector<Box> boxes = scatter(state.range(0));
+
+    for (auto _ : state) {
+        size_t hits = 0;
+        for (size_t i = 0; i < boxes.size(); ++i)
+            for (size_t j = i + 1; j < boxes.size(); ++j)
+                hits += overlap(boxes[i], boxes[j]);
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_BroadPhaseGrid(benchmark::State& state)
+{
+    std::vector<Box> boxes = scatter(state.range(0));
+    engine::physics::SpatialGrid grid(WINDOW_WIDTH, WINDOW_HEIGHT, COLLISION_GRID_CELL_SIZE);
+
+    size_t candidates = 0;
+    for (auto _ : state) {
+        grid.clear();
+        for (std::uint32_t i = 0; i < boxes.size(); ++i)
+            grid.insert(i, boxes[i].left, boxes[i].top, boxes[i].right, boxes[i].bottom);
+        grid.build();
+        size_t hits = 0;
+        candidates = 0;
+        grid.forEachPair([&](std::uint32_t a, std::uint32_t b) {
+            ++candidates;
+            hits += overlap(boxes[a], boxes[b]);
+        });
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["candidates"] = static_cast<double>(candidates);
+}
+
+void setupEngine(gameEngine::GameEngine& engine)
+{
+    engine.init();
+    engine.registerComponent<Transform>();
+    engine.registerComponent<Velocity>();
+    engine.registerComponent<Sprite>();
+    engine.registerComponent<Health>();
+    engine.registerComponent<HitBox>();
+    engine.registerComponent<Projectile>();
+    engine.registerComponent<Team>();
+    engine.registerSystem<ScoreSystem>(engine);
+    engine.setSystemSignature<ScoreSystem, Score, Text>();
+    engine.registerSystem<CollisionSystem>(engine);
+    engine.setSystemSignature<CollisionSystem, Transform, HitBox>();
+}
+
+/**
+ * @brief One CollisionSystem pass over enemies that touch but never damage each other.
+ */
+void BM_CollisionSystem(benchmark::State& state)
+{
+    gameEngine::GameEngine engine;
+    setupEngine(engine);
+    CollisionSystem& system = engine.getSystem<CollisionSystem>();
+
+    for (const Box& box : scatter(state.range(0))) {
+        // Networked IDs, as on the server: the local range stops below 10k
+        Entity e = engine.createEntity("Enemy", EntityCategory::NETWORKED);
+        engine.addComponent(e, Transform(box.left, box.top, 0.f, 1.f));
+        engine.addComponent(e, Sprite(Assets::BASE_ENEMY, ZIndex::IS_GAME,
+            sf::IntRect(0, 0, static_cast<int>(COLLIDER_SIZE), static_cast<int>(COLLIDER_SIZE))));
+        engine.addComponent(e, HitBox{});
+        engine.addComponent(e, Team(TeamType::ENEMY));
+        engine.addComponent(e, Health(100, 100));
+    }
+
+    for (auto _ : state)
+        system.onUpdate(1.f / 60.f);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief One CollisionSystem pass over a crowd of player bullets, a few players and enemies.
+ *
+ * Bullets can only hit enemies: the layer matrix
+ * drops their pairs with each other and with the players. They move at
+ * BULLET_SPEED, so they are swept over a 30 Hz tick.
+ */
+void BM_CollisionSystemMixedTeams(benchmark::State& state)
+{
+    gameEngine::GameEngine engine;
+    setupEngine(engine);
+    CollisionSystem& system = engine.getSystem<CollisionSystem>();
+
+    Entity shooter = engine.createEntity("Player", EntityCategory::NETWORKED);
+    std::vector<Box> boxes = scatter(state.range(0));
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        Entity e = engine.createEntity("Collider", EntityCategory::NETWORKED);
+        engine.addComponent(e, Transform(boxes[i].left, boxes[i].top, 0.f, 1.f));
+        engine.addComponent(e, HitBox::box(COLLIDER_SIZE, COLLIDER_SIZE));
+        if (i % 8 == 0) {
+            engine.addComponent(e, Team(TeamType::PLAYER));
+        } else if (i % 8 == 1) {
+            // Enemies with no Health: hits are classified but nothing dies between iterations
+            engine.addComponent(e, Team(TeamType::ENEMY));
+        } else {
+            engine.addComponent(e, Team(TeamType::PLAYER));
+            engine.addComponent(e, Projectile(shooter, true, 0));
+            engine.addComponent(e, Velocity(BULLET_SPEED, 0.f));
+        }
+    }
+
+    for (auto _ : state)
+        system.onUpdate(1.f / 30.f);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["events"] = static_cast<double>(engine.getResource<CollisionEvents>().collisions.size());
+}
+
+#define COLLIDER_COUNTS Arg(100)->Arg(1000)->Arg(10000)
+
+BENCHMARK(BM_BroadPhaseAllPairs)->COLLIDER_COUNTS;
+BENCHMARK(BM_BroadPhaseGrid)->COLLIDER_COUNTS;
+BENCHMARK(BM_CollisionSystem)->COLLIDER_COUNTS;
+BENCHMARK(BM_CollisionSystemMixedTeams)->COLLIDER_COUNTS;
+
+} // namespace
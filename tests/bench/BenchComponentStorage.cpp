@@ -0,0 +1,146 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** BenchComponentStorage
+*/
+
+// Component storage benchmarks of rtype_bench: the paged sparse set against
+// the previous one-optional-per-entity-ID layout, on a Position += Speed pass.
+
+#include <benchmark/benchmark.h>
+
+#include <engine/ecs/component/ComponentManager.hpp>
+#include <engine/ecs/entity/EntityManager.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace {
+
+struct Position {
+    float x;
+    float y;
+};
+
+struct Speed {
+    float vx;
+    float vy;
+};
+
+/**
+ * @brief Previous ComponentManager layout (one optional slot per entity ID), kept for comparison.
+ */
+template <typename Component>
+struct LegacyStorage {
+    std::vector<std::optional<Component>> data;
+
+    std::optional<Component>& operator[](size_t idx) {
+        if (idx >= data.size())
+            data.resize(idx + 1);
+        return data[idx];
+    }
+
+    size_t memoryUsage() const { return data.capacity() * sizeof(std::optional<Component>); }
+
+    size_t engaged() const
+    {
+        size_t count = 0;
+        for (const auto& slot : data)
+            count += slot.has_value();
+        return count;
+    }
+};
+
+/**
+ * @brief Spawns count distinct entities: half local, half networked, like a running game.
+ *
+ * Local IDs stay below NETWORKED_ID_OFFSET; once they run out, the rest are networked.
+ */
+std::vector<size_t> makeIds(int64_t count)
+{
+    std::vector<size_t> ids;
+    ids.reserve(static_cast<size_t>(count));
+    size_t local = 0;
+    size_t networked = 0;
+    for (size_t i = 0; i < static_cast<size_t>(count); ++i) {
+        if (i % 2 == 0 && local + 1 < NETWORKED_ID_OFFSET)
+            ids.push_back(1 + local++);
+        else
+            ids.push_back(NETWORKED_ID_OFFSET + networked++);
+    }
+    return ids;
+}
+
+/**
+ * @brief Reports the entries actually stored, as items per iteration and as the "entities" counter.
+ */
+void reportStored(benchmark::State& state, size_t stored)
+{
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stored));
+    state.counters["entities"] = static_cast<double>(stored);
+}
+
+void BM_LegacyStorageIteration(benchmark::State& state)
+{
+    LegacyStorage<Position> positions;
+    LegacyStorage<Speed> speeds;
+    // A third, unrelated pool touched once by a networked ID (e.g. Sprite, Text...)
+    LegacyStorage<Position> unrelated;
+    std::vector<size_t> ids = makeIds(state.range(0));
+
+    for (size_t id : ids) {
+        positions[id] = Position{0.f, 0.f};
+        speeds[id] = Speed{1.f, 1.f};
+    }
+    unrelated[ids.back()] = Position{0.f, 0.f};
+
+    for (auto _ : state) {
+        for (size_t e = 0; e < positions.data.size(); ++e) {
+            if (!positions[e] || !speeds[e])
+                continue;
+            positions[e]->x += speeds[e]->vx;
+            positions[e]->y += speeds[e]->vy;
+        }
+        benchmark::ClobberMemory();
+    }
+    reportStored(state, speeds.engaged());
+    state.counters["bytes"] = static_cast<double>(positions.memoryUsage() + speeds.memoryUsage()
+        + unrelated.memoryUsage());
+}
+
+void BM_SparseSetStorageIteration(benchmark::State& state)
+{
+    ComponentManager<Position> positions;
+    ComponentManager<Speed> speeds;
+    ComponentManager<Position> unrelated;
+    std::vector<size_t> ids = makeIds(state.range(0));
+
+    for (size_t id : ids) {
+        positions.insertAt(id, Position{0.f, 0.f});
+        speeds.insertAt(id, Speed{1.f, 1.f});
+    }
+    unrelated.insertAt(ids.back(), Position{0.f, 0.f});
+
+    for (auto _ : state) {
+        speeds.forEach([&](size_t e, Speed& vel) {
+            Position* pos = positions.tryGet(e);
+            if (!pos)
+                return;
+            pos->x += vel.vx;
+            pos->y += vel.vy;
+        });
+        benchmark::ClobberMemory();
+    }
+    reportStored(state, speeds.packedSize());
+    state.counters["bytes"] = static_cast<double>(positions.memoryUsage() + speeds.memoryUsage()
+        + unrelated.memoryUsage());
+}
+
+#define STORAGE_SIZES Arg(1000)->Arg(10000)->Arg(50000)
+
+BENCHMARK(BM_LegacyStorageIteration)->STORAGE_SIZES;
+BENCHMARK(BM_SparseSetStorageIteration)->STORAGE_SIZES;
+
+} // namespace
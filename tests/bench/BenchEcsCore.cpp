@@ -0,0 +1,272 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** BenchEcsCore
+*/
+
+// Google Benchmark suite of the ECS core operations (target rtype_bench).
+// Compare two runs with:
+//   rtype_bench --benchmark_out=before.json --benchmark_out_format=json
+//   (change the ECS, rebuild)
+//   rtype_bench --benchmark_out=after.json --benchmark_out_format=json
+//   <benchmark>/tools/compare.py benchmarks before.json after.json
+
+#include <benchmark/benchmark.h>
+
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/component/Components.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// Local entity IDs stay below NETWORKED_ID_OFFSET
+constexpr int64_t SMALL_WORLD = 256;
+constexpr int64_t MEDIUM_WORLD = 2048;
+constexpr int64_t LARGE_WORLD = 8192;
+
+constexpr size_t EXTRA_SYSTEMS = 11; /**< Query-like systems added to the 15 of the game */
+
+template <int N>
+class NthSystem : public System {};
+
+/**
+ * @brief Registers the components used by the benchmarks.
+ */
+void registerComponents(EntityManager& em)
+{
+    em.registerComponent<Transform>();
+    em.registerComponent<Velocity>();
+    em.registerComponent<Sprite>();
+    em.registerComponent<HitBox>();
+    em.registerComponent<Health>();
+    em.registerComponent<Weapon>();
+    em.registerComponent<Animation>();
+    em.registerComponent<InputComponent>();
+    em.registerComponent<Team>();
+    em.registerComponent<Projectile>();
+}
+
+template <class... Components>
+Signature signatureOf()
+{
+    Signature sig;
+    (sig.set(EntityManager::getComponentTypeId<Components>()), ...);
+    return sig;
+}
+
+template <int N>
+void addSystem(SystemManager& sm, const Signature& sig)
+{
+    sm.addSystem<NthSystem<N>>();
+    sm.setSignature<NthSystem<N>>(sig);
+}
+
+template <int... N>
+void addExtraSystems(SystemManager& sm, std::integer_sequence<int, N...>)
+{
+    const Signature extras[] = {
+        signatureOf<Transform>(), signatureOf<Velocity>(), signatureOf<Sprite>(),
+        signatureOf<Transform, HitBox>(), signatureOf<Team>(), signatureOf<Health, Team>(),
+        signatureOf<Projectile>(), signatureOf<Transform, Velocity, Projectile>(),
+        signatureOf<Sprite, HitBox>(), signatureOf<Weapon>(), signatureOf<Transform, Team>(),
+    };
+    (addSystem<100 + N>(sm, extras[N % std::size(extras)]), ...);
+}
+
+/**
+ * @brief Registers the 15 system signatures of Coordinator::initEngine plus EXTRA_SYSTEMS more.
+ *
+ * Components the game's systems need but the benchmark does not register
+ * are replaced by registered ones with the same arity.
+ */
+void registerGameSystems(SystemManager& sm)
+{
+    addSystem<0>(sm, signatureOf<Velocity, InputComponent>());              // PlayerSystem
+    addSystem<1>(sm, signatureOf<Transform, Velocity>());                   // MovementSystem
+    addSystem<2>(sm, signatureOf<Weapon, Transform>());                     // ShootSystem
+    addSystem<3>(sm, signatureOf<Health>());                                // LevelSystem
+    addSystem<4>(sm, signatureOf<InputComponent, Transform>());             // ButtonSystem
+    addSystem<5>(sm, signatureOf<Animation>());                             // AccessibilitySystem
+    addSystem<6>(sm, signatureOf<Team>());                                  // RebindSystem
+    addSystem<7>(sm, signatureOf<Health, Sprite>());                        // ScoreSystem
+    addSystem<8>(sm, signatureOf<Transform, Sprite, HitBox>());             // CollisionSystem
+    addSystem<9>(sm, signatureOf<Transform>());                             // DestroySystem
+    addSystem<10>(sm, signatureOf<Transform, Sprite, Animation>());         // BackgroundSystem
+    addSystem<11>(sm, signatureOf<Animation, Sprite>());                    // AnimationSystem
+    addSystem<12>(sm, signatureOf<Projectile>());                           // AudioSystem
+    addSystem<13>(sm, signatureOf<Transform, Sprite>());                    // RenderSystem
+    addSystem<14>(sm, signatureOf<Health, Weapon>());                       // LevelTimerSystem
+    addExtraSystems(sm, std::make_integer_sequence<int, EXTRA_SYSTEMS>{});
+}
+
+/**
+ * @brief Spawns `count` enemy-like entities (Transform, Velocity, Sprite, HitBox).
+ */
+std::vector<Entity> populate(EntityManager& em, int64_t count)
+{
+    std::vector<Entity> entities = em.spawnEntities(static_cast<size_t>(count), "enemy");
+    for (Entity e : entities) {
+        em.emplaceComponent<Transform>(e, 0.f, 0.f, 0.f, 1.f);
+        em.emplaceComponent<Velocity>(e, -1.f, 0.f);
+        em.emplaceComponent<Sprite>(e, Assets::BASE_ENEMY, ZIndex::IS_GAME, sf::Rect<int>(0, 0, 32, 32));
+        em.emplaceComponent<HitBox>(e);
+    }
+    return entities;
+}
+
+void BM_SpawnKill(benchmark::State& state)
+{
+    EntityManager em;
+    registerComponents(em);
+    populate(em, state.range(0));
+
+    for (auto _ : state) {
+        Entity e = em.spawnEntity("projectile");
+        em.killEntity(e);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SpawnKillWithComponents(benchmark::State& state)
+{
+    EntityManager em;
+    registerComponents(em);
+    populate(em, state.range(0));
+
+    for (auto _ : state) {
+        Entity e = em.spawnEntity("projectile");
+        em.emplaceComponent<Transform>(e, 0.f, 0.f, 0.f, 1.f);
+        em.emplaceComponent<Velocity>(e, 8.f, 0.f);
+        em.emplaceComponent<HitBox>(e);
+        em.killEntity(e);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_AddRemoveComponent(benchmark::State& state)
+{
+    EntityManager em;
+    registerComponents(em);
+    std::vector<Entity> entities = populate(em, state.range(0));
+
+    size_t next = 0;
+    for (auto _ : state) {
+        Entity e = entities[next];
+        em.emplaceComponent<Health>(e, 10, 10);
+        em.removeComponent<Health>(e);
+        next = (next + 1) % entities.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SignaturePropagation(benchmark::State& state)
+{
+    EntityManager em;
+    SystemManager sm;
+    em.setSystemManager(&sm);
+    registerComponents(em);
+    registerGameSystems(sm);
+    std::vector<Entity> entities = populate(em, state.range(0));
+
+    size_t next = 0;
+    for (auto _ : state) {
+        Entity e = entities[next];
+        em.emplaceComponent<Projectile>(e, Entity::fromId(1), true, 1);
+        em.removeComponent<Projectile>(e);
+        next = (next + 1) % entities.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["systems"] = static_cast<double>(15 + EXTRA_SYSTEMS);
+}
+
+void BM_SpawnKillWithSystems(benchmark::State& state)
+{
+    EntityManager em;
+    SystemManager sm;
+    em.setSystemManager(&sm);
+    registerComponents(em);
+    registerGameSystems(sm);
+    populate(em, state.range(0));
+
+    for (auto _ : state) {
+        Entity e = em.spawnEntity("projectile");
+        em.emplaceComponent<Transform>(e, 0.f, 0.f, 0.f, 1.f);
+        em.emplaceComponent<Velocity>(e, 8.f, 0.f);
+        em.emplaceComponent<HitBox>(e);
+        em.killEntity(e);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_PoolIteration(benchmark::State& state)
+{
+    EntityManager em;
+    registerComponents(em);
+    populate(em, state.range(0));
+    ComponentManager<Transform>& transforms = em.getComponents<Transform>();
+
+    for (auto _ : state) {
+        for (ComponentManager<Transform>::sizeType i = 0; i < transforms.packedSize(); ++i)
+            transforms.packedAt(i).x += 1.f;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ViewIteration(benchmark::State& state)
+{
+    EntityManager em;
+    SystemManager sm;
+    em.setSystemManager(&sm);
+    registerComponents(em);
+    populate(em, state.range(0));
+
+    for (auto _ : state) {
+        em.view<Transform, Velocity>().each([](size_t, Transform& t, Velocity& v) {
+            t.x += v.vx;
+            t.y += v.vy;
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_IsAlive(benchmark::State& state)
+{
+    EntityManager em;
+    registerComponents(em);
+    std::vector<Entity> entities = populate(em, state.range(0));
+    // Half of the handles are stale: their entity was killed and the ID recycled
+    for (size_t i = 0; i < entities.size(); i += 2) {
+        em.killEntity(entities[i]);
+        em.spawnEntity("recycled");
+    }
+
+    size_t next = 0;
+    size_t alive = 0;
+    for (auto _ : state) {
+        alive += em.isAlive(entities[next]);
+        next = (next + 1) % entities.size();
+    }
+    benchmark::DoNotOptimize(alive);
+    state.SetItemsProcessed(state.iterations());
+}
+
+#define ECS_WORLD_SIZES Arg(SMALL_WORLD)->Arg(MEDIUM_WORLD)->Arg(LARGE_WORLD)
+
+BENCHMARK(BM_SpawnKill)->ECS_WORLD_SIZES;
+BENCHMARK(BM_SpawnKillWithComponents)->ECS_WORLD_SIZES;
+BENCHMARK(BM_AddRemoveComponent)->ECS_WORLD_SIZES;
+BENCHMARK(BM_SignaturePropagation)->ECS_WORLD_SIZES;
+BENCHMARK(BM_SpawnKillWithSystems)->ECS_WORLD_SIZES;
+BENCHMARK(BM_PoolIteration)->ECS_WORLD_SIZES;
+BENCHMARK(BM_ViewIteration)->ECS_WORLD_SIZES;
+BENCHMARK(BM_IsAlive)->ECS_WORLD_SIZES;
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** BenchSnapshot
+*/
+
+// World snapshot benchmarks of rtype_bench: saveState() and restoreState()
+// on a busy co-op wave, the rollback target.
+
+#include <benchmark/benchmark.h>
+
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/component/Components.hpp>
+
+namespace {
+
+class MovementBench : public System {};
+
+constexpr size_t ENTITIES = 2000;   /**< Rollback target: a busy co-op wave */
+
+/**
+ * @brief Fills a world like a running game: enemies, projectiles, a few players.
+ */
+void populate(EntityManager& em)
+{
+    for (size_t i = 0; i < ENTITIES; ++i) {
+        Entity e = em.spawnEntity(i % 4 == 0 ? "enemy" : "projectile",
+            i % 2 == 0 ? EntityCategory::NETWORKED : EntityCategory::LOCAL);
+        em.emplaceComponent<Transform>(e, static_cast<float>(i), 0.f, 0.f, 1.f);
+        em.emplaceComponent<Velocity>(e, -1.f, 0.f);
+        em.emplaceComponent<HitBox>(e);
+        em.emplaceComponent<Team>(e, i % 4 == 0 ? TeamType::ENEMY : TeamType::PLAYER);
+        if (i % 4 == 0) {
+            em.emplaceComponent<Health>(e, 10, 10);
+            em.emplaceComponent<Sprite>(e, Assets::BASE_ENEMY, ZIndex::IS_GAME, sf::Rect<int>(0, 0, 32, 32));
+        } else {
+            em.emplaceComponent<Projectile>(e, Entity::fromId(1), true, 1);
+        }
+        if (i % 500 == 0)
+            em.emplaceComponent<InputComponent>(e, static_cast<uint32_t>(i));
+    }
+}
+
+/**
+ * @brief A populated world whose snapshot ring already went around once.
+ */
+struct SnapshotWorld {
+    EntityManager em;
+    SystemManager sm;
+
+    SnapshotWorld()
+    {
+        em.setSystemManager(&sm);
+        em.registerComponent<Transform>();
+        em.registerComponent<Velocity>();
+        em.registerComponent<HitBox>();
+        em.registerComponent<Team>();
+        em.registerComponent<Health>();
+        em.registerComponent<Sprite>();
+        em.registerComponent<Projectile>();
+        em.registerComponent<InputComponent>();
+
+        sm.addSystem<MovementBench>();
+        Signature movement;
+        movement.set(em.getComponentTypeId<Transform>());
+        movement.set(em.getComponentTypeId<Velocity>());
+        sm.setSignature<MovementBench>(movement);
+
+        populate(em);
+
+        // First lap of the ring grows the snapshot buffers
+        for (size_t i = 0; i < DEFAULT_SNAPSHOT_SLOTS; ++i)
+            em.saveState();
+    }
+};
+
+void BM_SnapshotSave(benchmark::State& state)
+{
+    SnapshotWorld world;
+
+    for (auto _ : state) {
+        SnapshotHandle handle = world.em.saveState();
+        benchmark::DoNotOptimize(handle);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ENTITIES));
+}
+
+void BM_SnapshotRestore(benchmark::State& state)
+{
+    SnapshotWorld world;
+    SnapshotHandle handle = world.em.saveState();
+
+    for (auto _ : state) {
+        // One simulated frame to roll back
+        world.em.view<Transform, Velocity>().each([](size_t, Transform& t, Velocity& v) {
+            t.x += v.vx;
+        });
+        world.em.restoreState(handle);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ENTITIES));
+}
+
+BENCHMARK(BM_SnapshotSave);
+BENCHMARK(BM_SnapshotRestore);
+
+} // namespace
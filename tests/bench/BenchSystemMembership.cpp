@@ -0,0 +1,170 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** BenchSystemMembership
+*/
+
+// System membership benchmarks of rtype_bench: projectile churn through the
+// cached SystemManager against the previous linear find/remove on every system.
+// One iteration is one projectile: spawned, given its five components one by
+// one, and the oldest live projectile killed.
+
+#include <benchmark/benchmark.h>
+
+#include <engine/ecs/system/SystemManager.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// One distinct type per registered system, as SystemManager keys on the type.
+template <int N>
+class NthSystem : public System {};
+
+/**
+ * @brief Previous SystemManager behaviour (linear find/remove on every system), kept for comparison.
+ */
+struct LegacyMembership {
+    std::vector<Signature> signatures;
+    std::vector<std::vector<size_t>> entities;
+
+    void entitySignatureChanged(size_t entity, const Signature& entitySig)
+    {
+        for (size_t s = 0; s < signatures.size(); ++s) {
+            auto& vec = entities[s];
+            if ((entitySig & signatures[s]) == signatures[s]) {
+                if (std::find(vec.begin(), vec.end(), entity) == vec.end())
+                    vec.push_back(entity);
+            } else {
+                vec.erase(std::remove(vec.begin(), vec.end(), entity), vec.end());
+            }
+        }
+    }
+};
+
+// Component bits used by a projectile: Transform, Velocity, Sprite, HitBox, Projectile.
+constexpr size_t TRANSFORM = 0;
+constexpr size_t VELOCITY = 1;
+constexpr size_t SPRITE = 2;
+constexpr size_t HITBOX = 3;
+constexpr size_t PROJECTILE = 4;
+constexpr size_t COMPONENTS[] = {TRANSFORM, VELOCITY, SPRITE, HITBOX, PROJECTILE};
+
+constexpr size_t ALIVE_PROJECTILES = 2000;   /**< Projectiles on screen at any time */
+
+/**
+ * @brief Signatures of the gameplay systems that see projectiles (movement, render, collision, ...).
+ */
+std::vector<Signature> makeSystemSignatures()
+{
+    auto sig = [](std::initializer_list<size_t> bits) {
+        Signature s;
+        for (size_t b : bits)
+            s.set(b);
+        return s;
+    };
+    return {
+        sig({TRANSFORM, VELOCITY}),
+        sig({TRANSFORM, SPRITE}),
+        sig({TRANSFORM, HITBOX}),
+        sig({TRANSFORM, SPRITE, HITBOX}),
+        sig({TRANSFORM}),
+        sig({PROJECTILE}),
+        sig({TRANSFORM, VELOCITY, PROJECTILE}),
+        sig({SPRITE}),
+    };
+}
+
+/**
+ * @brief Rolling pool of live projectile IDs, notified through notify(id, signature).
+ */
+template <class Notify>
+class ProjectileChurn {
+public:
+    explicit ProjectileChurn(Notify notify) : _notify(std::move(notify)) {}
+
+    /**
+     * @brief Spawns one projectile and kills the oldest one past ALIVE_PROJECTILES.
+     */
+    void step()
+    {
+        size_t id;
+        if (!_freeIds.empty()) {
+            id = _freeIds.back();
+            _freeIds.pop_back();
+        } else {
+            id = _nextId++;
+        }
+
+        Signature sig;
+        _notify(id, sig);
+        for (size_t bit : COMPONENTS) {
+            sig.set(bit);
+            _notify(id, sig);
+        }
+        _alive.push_back(id);
+
+        if (_alive.size() > ALIVE_PROJECTILES) {
+            size_t victim = _alive.front();
+            _alive.pop_front();
+            _notify(victim, Signature());
+            _freeIds.push_back(victim);
+        }
+    }
+
+private:
+    Notify _notify;
+    std::deque<size_t> _alive;
+    std::vector<size_t> _freeIds;
+    size_t _nextId = 1;
+};
+
+template <class Notify>
+void runChurn(benchmark::State& state, Notify notify)
+{
+    ProjectileChurn<Notify> churn(std::move(notify));
+    // Start from a full screen of projectiles
+    for (size_t i = 0; i < ALIVE_PROJECTILES; ++i)
+        churn.step();
+
+    for (auto _ : state)
+        churn.step();
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LegacyMembershipChurn(benchmark::State& state)
+{
+    LegacyMembership legacy;
+    legacy.signatures = makeSystemSignatures();
+    legacy.entities.resize(legacy.signatures.size());
+
+    runChurn(state, [&legacy](size_t id, const Signature& sig) {
+        legacy.entitySignatureChanged(id, sig);
+    });
+}
+
+template <int... N>
+void registerSystems(SystemManager& manager, const std::vector<Signature>& sigs, std::integer_sequence<int, N...>)
+{
+    ((manager.addSystem<NthSystem<N>>(), manager.setSignature<NthSystem<N>>(sigs[N])), ...);
+}
+
+void BM_CachedMembershipChurn(benchmark::State& state)
+{
+    SystemManager manager;
+    std::vector<Signature> sigs = makeSystemSignatures();
+    registerSystems(manager, sigs, std::make_integer_sequence<int, 8>{});
+
+    runChurn(state, [&manager](size_t id, const Signature& sig) {
+        manager.entitySignatureChanged(id, sig);
+    });
+}
+
+BENCHMARK(BM_LegacyMembershipChurn);
+BENCHMARK(BM_CachedMembershipChurn);
+
+} // namespace
@@ -20,10 +20,7 @@ std::shared_ptr<gameEngine::GameEngine> createTestEngine()
     engine->registerComponent<Text>();
     engine->registerComponent<ButtonComponent>();
     engine->registerComponent<ScrollingBackground>();
-    engine->registerComponent<GameConfig>();
-
-    Entity configEntity = engine->createEntity("GameConfig");
-    engine->addComponent(configEntity, GameConfig(FontAssets::DEFAULT_FONT, true, true));
+    engine->insertResource<GameConfig>(FontAssets::DEFAULT_FONT, true, true);
 
     engine->_renderManager = std::make_shared<RenderManager>();
 
@@ -118,16 +115,9 @@ TEST_F(ClientMenuTest, AccessibilityMenuTogglesFont)
 
     menu->update();
 
-    auto& configs = engine->getComponents<GameConfig>();
-    bool found = false;
-    for (auto& config : configs) {
-        if (config.has_value()) {
-            EXPECT_EQ(config->activeFont, FontAssets::DYSLEXIC_FONT);
-            found = true;
-            break;
-        }
-    }
-    EXPECT_TRUE(found);
+    GameConfig* config = engine->tryGetResource<GameConfig>();
+    ASSERT_NE(config, nullptr);
+    EXPECT_EQ(config->activeFont, FontAssets::DYSLEXIC_FONT);
 }
 
 TEST_F(ClientMenuTest, CreatePlayMenuAddsBackButton)
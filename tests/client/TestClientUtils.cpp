@@ -18,7 +18,6 @@ gameEngine::GameEngine makeEngine()
     engine.registerComponent<Animation>();
     engine.registerComponent<ScrollingBackground>();
     engine.registerComponent<Rebind>();
-    engine.registerComponent<GameConfig>();
     return engine;
 }
 
@@ -128,8 +127,7 @@ TEST(ClientUtilsCoverage, KeyToStringAndConfigLookup)
     EXPECT_EQ(keyToString(sf::Keyboard::Unknown), "UNKNOWN");
 
     auto engine = makeEngine();
-    Entity config = engine.createEntity("config");
-    engine.addComponent(config, GameConfig(FontAssets::DEFAULT_FONT, true, true));
+    engine.insertResource<GameConfig>(FontAssets::DEFAULT_FONT, true, true);
 
     EXPECT_EQ(getKeybordKeyFromGameConfig(engine, GameAction::MOVE_LEFT), "LEFT");
     EXPECT_EQ(getKeybordKeyFromGameConfig(engine, GameAction::SHOOT), "SPACE");
@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** AllocationAssertions
+*/
+
+#ifndef ALLOCATIONASSERTIONS_HPP_
+#define ALLOCATIONASSERTIONS_HPP_
+
+#include <gtest/gtest.h>
+#include <engine/core/AllocationProfiler.hpp>
+
+/**
+ * @brief Predicate for EXPECT_TRUE / ASSERT_TRUE: at most `limit` allocations were recorded.
+ */
+inline ::testing::AssertionResult AllocationsAtMost(const AllocationStats& stats, std::uint64_t limit)
+{
+    if (stats.count <= limit)
+        return ::testing::AssertionSuccess();
+    return ::testing::AssertionFailure() << stats.count << " allocations (" << stats.bytes
+        << " bytes), expected at most " << limit;
+}
+
+/**
+ * @brief Skips the test in builds without the allocation hook (RTYPE_ALLOC_PROFILER OFF).
+ */
+#define SKIP_WITHOUT_ALLOCATION_PROFILER() \
+    do { \
+        if (!AllocationProfiler::ENABLED) \
+            GTEST_SKIP() << "configure with -DRTYPE_ALLOC_PROFILER=ON to count allocations"; \
+    } while (0)
+
+/**
+ * @brief Runs a statement and expects it to allocate at most `limit` times on this thread.
+ */
+#define EXPECT_ALLOCATIONS_AT_MOST(limit, statement) \
+    do { \
+        AllocationStats allocationsBefore_ = AllocationProfiler::threadTotals(); \
+        statement; \
+        EXPECT_TRUE(AllocationsAtMost(AllocationProfiler::threadTotals() - allocationsBefore_, (limit))) \
+            << "in: " #statement; \
+    } while (0)
+
+#endif /* !ALLOCATIONASSERTIONS_HPP_ */
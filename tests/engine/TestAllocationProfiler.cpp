@@ -0,0 +1,106 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** test_allocation_profiler
+*/
+
+#include <gtest/gtest.h>
+#include "AllocationAssertions.hpp"
+#include "game/coordinator/Coordinator.hpp"
+#include <engine/core/FrameArena.hpp>
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t PLAYERS = 4;
+constexpr uint32_t WAVE_ENEMIES = 24;
+constexpr int WARM_UP_TICKS = 30;
+constexpr int MEASURED_TICKS = 60;
+constexpr std::uint64_t MAX_ALLOCATIONS_PER_TICK = 16;  /**< Packets still own their payload vector */
+
+} // namespace
+
+TEST(AllocationProfilerTest, ScopesAndTicksCountAllocations) {
+    SKIP_WITHOUT_ALLOCATION_PROFILER();
+    AllocationProfiler::reset();
+
+    AllocationProfiler::beginTick();
+    {
+        PROFILE_ALLOCATIONS("test::allocating");
+        auto values = std::make_unique<std::vector<int>>(100);
+        EXPECT_EQ(values->size(), 100u);
+    }
+    AllocationProfiler::endTick();
+
+    EXPECT_EQ(AllocationProfiler::scope("test::allocating").count, 2u);
+    EXPECT_GE(AllocationProfiler::scope("test::allocating").bytes, 100 * sizeof(int));
+    EXPECT_EQ(AllocationProfiler::lastTick().count, 2u);
+    EXPECT_EQ(AllocationProfiler::tickCount(), 1u);
+
+    std::vector<int> reused;
+    reused.reserve(16);
+    EXPECT_ALLOCATIONS_AT_MOST(0, reused.assign(16, 1));
+}
+
+TEST(AllocationProfilerTest, DumpIsOneJsonObject) {
+    AllocationProfiler::reset();
+    AllocationProfiler::addToScope("Coordinator::\"quoted\"", AllocationStats{3, 48});
+    AllocationProfiler::addToScope("Coordinator::\"quoted\"", AllocationStats{1, 16});
+
+    std::ostringstream out;
+    AllocationProfiler::dump(out);
+    EXPECT_NE(out.str().find("\"name\":\"Coordinator::\\\"quoted\\\"\",\"count\":4,\"bytes\":64,\"calls\":2"),
+        std::string::npos) << out.str();
+    AllocationProfiler::reset();
+}
+
+TEST(AllocationProfilerTest, SteadyStateServerTickIsBounded) {
+    SKIP_WITHOUT_ALLOCATION_PROFILER();
+
+    Coordinator coord;
+    coord.setIsServer(true);
+    coord.initEngine();
+    auto engine = coord.getEngine();
+    ASSERT_NE(engine, nullptr);
+
+    for (uint32_t player = 1; player <= PLAYERS; ++player)
+        coord.createPlayerEntity(player, 100.f, 100.f * player, 0.f, 0.f, 100, false, false);
+    for (uint32_t enemy = 0; enemy < WAVE_ENEMIES; ++enemy)
+        coord.createEnemyEntity(2000 + enemy, 1200.f + 40.f * enemy, 80.f + 30.f * enemy, 0.f, 0.f, 50,
+            EnemyType::BASIC, false);
+
+    std::vector<common::protocol::Packet> incoming;
+    std::vector<common::protocol::Packet> outgoing;
+    auto tick = [&]() {
+        AllocationProfiler::beginTick();
+        outgoing.clear();
+        {
+            PROFILE_ALLOCATIONS("Coordinator::processServerPackets");
+            coord.processServerPackets(incoming, TICK_RATE);
+        }
+        coord.updateSystems(TICK_RATE / 1000.0f);
+        {
+            PROFILE_ALLOCATIONS("Coordinator::buildServerPacketBasedOnStatus");
+            coord.buildServerPacketBasedOnStatus(outgoing, TICK_RATE);
+        }
+        FrameArena::nextFrame();
+        AllocationProfiler::endTick();
+    };
+
+    // Warm-up: buffers, arenas and snapshot lists reach their working size
+    for (int i = 0; i < WARM_UP_TICKS; ++i)
+        tick();
+    AllocationProfiler::reset();
+
+    for (int i = 0; i < MEASURED_TICKS; ++i)
+        tick();
+
+    AllocationProfiler::logReport();
+    EXPECT_EQ(AllocationProfiler::tickCount(), static_cast<std::uint64_t>(MEASURED_TICKS));
+    EXPECT_TRUE(AllocationsAtMost(AllocationProfiler::allTicks(), MAX_ALLOCATIONS_PER_TICK * MEASURED_TICKS));
+    AllocationProfiler::reset();
+}
@@ -15,7 +15,6 @@ AudioSystem& setupAudioSystem(gameEngine::GameEngine& engine)
     engine.init();
     engine.registerComponent<AudioSource>();
     engine.registerComponent<Transform>();
-    engine.registerComponent<GameConfig>();
 
     engine._audioManager = std::make_shared<audio::AudioManager>();
 
@@ -50,8 +49,7 @@ TEST(AudioSystemCoverage, ReturnsWhenAudioDisabled)
     gameEngine::GameEngine engine;
     auto& system = setupAudioSystem(engine);
 
-    Entity config = engine.createEntity("config");
-    engine.addComponent(config, GameConfig(FontAssets::DEFAULT_FONT, false, false));
+    engine.insertResource<GameConfig>(FontAssets::DEFAULT_FONT, false, false);
 
     Entity audioEntity = createAudioEntity(engine, AudioSource(AudioAssets::SFX_MENU_SELECT, false, 0.0f, 0.0f, true, 0.1f));
 
@@ -67,8 +65,7 @@ TEST(AudioSystemCoverage, OneShotAndLoopingBehavior)
     gameEngine::GameEngine engine;
     auto& system = setupAudioSystem(engine);
 
-    Entity config = engine.createEntity("config");
-    engine.addComponent(config, GameConfig(FontAssets::DEFAULT_FONT, true, true));
+    engine.insertResource<GameConfig>(FontAssets::DEFAULT_FONT, true, true);
 
     Entity oneShot = createAudioEntity(engine, AudioSource(AudioAssets::SFX_MENU_SELECT, false, 0.0f, 0.0f, true, 0.1f));
 
@@ -99,8 +96,7 @@ TEST(AudioSystemCoverage, Skips3DSoundWithoutTransform)
     gameEngine::GameEngine engine;
     auto& system = setupAudioSystem(engine);
 
-    Entity config = engine.createEntity("config");
-    engine.addComponent(config, GameConfig(FontAssets::DEFAULT_FONT, true, true));
+    engine.insertResource<GameConfig>(FontAssets::DEFAULT_FONT, true, true);
 
     Entity audioEntity = createAudioEntity(engine, AudioSource(AudioAssets::SFX_SHOOT_BASIC, false, 0.0f, 0.0f, false, 0.1f));
 
@@ -116,8 +112,7 @@ TEST(AudioSystemCoverage, Plays3DSoundWhenTransformPresent)
     gameEngine::GameEngine engine;
     auto& system = setupAudioSystem(engine);
 
-    Entity config = engine.createEntity("config");
-    engine.addComponent(config, GameConfig(FontAssets::DEFAULT_FONT, true, true));
+    engine.insertResource<GameConfig>(FontAssets::DEFAULT_FONT, true, true);
 
     Entity audioEntity = createAudioEntity(engine, AudioSource(AudioAssets::SFX_SHOOT_BASIC, false, 0.0f, 0.0f, false, 0.1f));
     engine.addComponent(audioEntity, Transform(1.0f, 2.0f, 0.0f, 1.0f));
@@ -134,8 +129,7 @@ TEST(AudioSystemCoverage, RespectsMusicAndSoundToggles)
     gameEngine::GameEngine engine;
     auto& system = setupAudioSystem(engine);
 
-    Entity config = engine.createEntity("config");
-    engine.addComponent(config, GameConfig(FontAssets::DEFAULT_FONT, false, true));
+    engine.insertResource<GameConfig>(FontAssets::DEFAULT_FONT, false, true);
 
     Entity looping = createAudioEntity(engine, AudioSource(AudioAssets::MAIN_MENU_MUSIC, true, 0.0f, 0.0f, true, 0.1f));
     Entity oneShot = createAudioEntity(engine, AudioSource(AudioAssets::SFX_MENU_SELECT, false, 0.0f, 0.0f, true, 0.1f));
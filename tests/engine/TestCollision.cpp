@@ -0,0 +1,101 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** test_collision
+*/
+
+#include <gtest/gtest.h>
+#include <engine/physics/Collision.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace engine::physics;
+
+TEST(CollisionTest, ShapesOverlapOnlyWhenTheyShareArea) {
+    EXPECT_TRUE(Collision::checkAABB({0.f, 0.f, 10.f, 10.f}, {5.f, 5.f, 10.f, 10.f}));
+    // Touching edges
+    EXPECT_FALSE(Collision::checkAABB({0.f, 0.f, 10.f, 10.f}, {10.f, 0.f, 10.f, 10.f}));
+
+    EXPECT_TRUE(Collision::checkCircle({0.f, 0.f, 5.f}, {8.f, 0.f, 5.f}));
+    EXPECT_FALSE(Collision::checkCircle({0.f, 0.f, 5.f}, {10.f, 0.f, 5.f}));
+
+    // The circle reaches the box's side, not its corner
+    EXPECT_TRUE(Collision::checkAABBCircle({0.f, 0.f, 10.f, 10.f}, {14.f, 5.f, 5.f}));
+    EXPECT_FALSE(Collision::checkAABBCircle({0.f, 0.f, 10.f, 10.f}, {14.f, 14.f, 5.f}));
+    // Center inside the box
+    EXPECT_TRUE(Collision::checkAABBCircle({0.f, 0.f, 10.f, 10.f}, {5.f, 5.f, 1.f}));
+}
+
+TEST(CollisionTest, BatchTestMatchesTheExactTests) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> position(0.f, 200.f);
+    std::uniform_real_distribution<float> size(1.f, 30.f);
+    ColliderStore store;
+    // Empty shapes are not stored
+    EXPECT_FALSE(store.add(0, AABB{0.f, 0.f, 0.f, 10.f}));
+    EXPECT_FALSE(store.add(0, Circle{0.f, 0.f, 0.f}));
+    for (std::uint32_t i = 0; i < 64; ++i) {
+        if (i % 3 == 0)
+            store.add(i, Circle{position(rng), position(rng), size(rng)});
+        else
+            store.add(i, AABB{position(rng), position(rng), size(rng), size(rng)});
+    }
+    ASSERT_EQ(store.size(), 64u);
+
+    // Every pair, so the SIMD loop and its scalar tail both run
+    std::vector<std::uint32_t> first;
+    std::vector<std::uint32_t> second;
+    for (std::uint32_t a = 0; a < store.size(); ++a) {
+        for (std::uint32_t b = a + 1; b < store.size(); ++b) {
+            first.push_back(a);
+            second.push_back(b);
+        }
+    }
+    std::vector<std::uint8_t> hits(first.size());
+    Collision::checkPairs(store, first.data(), second.data(), first.size(), hits.data());
+
+    size_t overlapping = 0;
+    for (size_t k = 0; k < first.size(); ++k) {
+        EXPECT_EQ(hits[k] != 0, Collision::check(store, first[k], second[k])) << first[k] << " " << second[k];
+        overlapping += hits[k];
+    }
+    EXPECT_GT(overlapping, 0u);
+}
+
+TEST(CollisionTest, SweptShapesHitWhatTheyCrossDuringTheTick) {
+    float time = -1.f;
+    // A 4 px bullet moving 100 px to the right crosses a 2 px wide wall at x = 50
+    EXPECT_TRUE(Collision::sweepAABB({0.f, 0.f, 4.f, 4.f}, {50.f, -10.f, 2.f, 20.f}, 100.f, 0.f, time));
+    EXPECT_FLOAT_EQ(time, 0.46f);
+    // Same motion one line lower than the wall, or stopping short of it
+    EXPECT_FALSE(Collision::sweepAABB({0.f, 10.f, 4.f, 4.f}, {50.f, -10.f, 2.f, 20.f}, 100.f, 0.f, time));
+    EXPECT_FALSE(Collision::sweepAABB({0.f, 0.f, 4.f, 4.f}, {50.f, -10.f, 2.f, 20.f}, 46.f, 0.f, time));
+    // Already overlapping
+    EXPECT_TRUE(Collision::sweepAABB({0.f, 0.f, 4.f, 4.f}, {2.f, 2.f, 4.f, 4.f}, -30.f, 5.f, time));
+    EXPECT_FLOAT_EQ(time, 0.f);
+
+    EXPECT_TRUE(Collision::sweepCircle({0.f, 0.f, 2.f}, {50.f, 0.f, 3.f}, 100.f, 0.f, time));
+    EXPECT_FLOAT_EQ(time, 0.45f);
+    EXPECT_FALSE(Collision::sweepCircle({0.f, 0.f, 2.f}, {50.f, 6.f, 3.f}, 100.f, 0.f, time));
+    EXPECT_FALSE(Collision::sweepCircle({0.f, 0.f, 2.f}, {50.f, 0.f, 3.f}, -100.f, 0.f, time));
+
+    // In a store, the moved bullet ends past the wall: its box covers the path and the pair is swept
+    ColliderStore store;
+    store.add(0, AABB{96.f, 0.f, 4.f, 4.f});
+    store.move(0, 96.f, 0.f);
+    store.add(1, AABB{50.f, -10.f, 2.f, 20.f});
+    EXPECT_FLOAT_EQ(store.minX[0], 0.f);
+    EXPECT_FLOAT_EQ(store.maxX[0], 100.f);
+    EXPECT_FLOAT_EQ(store.box(0).x, 96.f);
+    EXPECT_FLOAT_EQ(store.box(0).width, 4.f);
+    EXPECT_FALSE(Collision::checkAABB(store.box(0), store.box(1)));
+    std::uint32_t first = 1;
+    std::uint32_t second = 0;
+    std::uint8_t hit = 0;
+    Collision::checkPairs(store, &first, &second, 1, &hit, &time);
+    EXPECT_EQ(hit, 1);
+    EXPECT_FLOAT_EQ(time, 46.f / 96.f);
+}
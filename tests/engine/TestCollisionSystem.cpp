@@ -3,6 +3,8 @@
 #include <engine/GameEngine.hpp>
 #include <common/constants/render/Assets.hpp>
 #include <game/systems/CollisionSystem.hpp>
+#include <game/systems/DamageSystem.hpp>
+#include <game/systems/DestroySystem.hpp>
 #include <game/systems/ScoreSystem.hpp>
 
 namespace {
@@ -12,6 +14,7 @@ CollisionSystem& setupCollisionSystem(gameEngine::GameEngine& engine)
     engine.init();
 
     engine.registerComponent<Transform>();
+    engine.registerComponent<Velocity>();
     engine.registerComponent<Sprite>();
     engine.registerComponent<Health>();
     engine.registerComponent<HitBox>();
@@ -19,12 +22,29 @@ CollisionSystem& setupCollisionSystem(gameEngine::GameEngine& engine)
     engine.registerComponent<Team>();
 
     engine.registerSystem<ScoreSystem>(engine);
+    engine.setSystemSignature<ScoreSystem, Score, Text>();
     auto& collisionSystem = engine.registerSystem<CollisionSystem>(engine);
-    engine.setSystemSignature<CollisionSystem, Transform, Sprite, HitBox>();
+    engine.setSystemSignature<CollisionSystem, Transform, HitBox>();
+    engine.registerSystem<DamageSystem>(engine);
+    engine.setSystemSignature<DamageSystem, Health>();
+    engine.registerSystem<DestroySystem>(engine);
+    engine.setSystemSignature<DestroySystem, Transform>();
 
     return collisionSystem;
 }
 
+/**
+ * @brief Runs the collision pass and its consumers, as the server pipeline does.
+ */
+void runCollisionPass(gameEngine::GameEngine& engine, CollisionSystem& system)
+{
+    system.onUpdate(0.016f);
+    engine.getSystem<DamageSystem>().onUpdate(0.016f);
+    engine.getSystem<ScoreSystem>().onUpdate(0.016f);
+    engine.getSystem<DestroySystem>().onUpdate(0.016f);
+    engine.getCommandBuffer().flush();
+}
+
 Entity createCollidable(gameEngine::GameEngine& engine,
                         float x,
                         float y,
@@ -50,4 +70,144 @@ TEST(CollisionSystemCoverage, ConstructorAndOnCreate)
 
     system.onCreate();
     SUCCEED();
-}
\ No newline at end of file
+}
+TEST(CollisionSystemCoverage, ProjectileHitsEnemyAcrossGridCells)
+{
+    gameEngine::GameEngine engine;
+    auto& system = setupCollisionSystem(engine);
+
+    // Both boxes straddle the boundary between two broad phase cells
+    Entity shooter = createCollidable(engine, 1000.0f, 1000.0f, 10, 10);
+    engine.addComponent(shooter, Team(TeamType::PLAYER));
+    Entity enemy = createCollidable(engine, COLLISION_GRID_CELL_SIZE - 10.0f, 100.0f, 40, 40);
+    engine.addComponent(enemy, Team(TeamType::ENEMY));
+    engine.addComponent(enemy, Health(50, 50));
+    Entity bullet = createCollidable(engine, COLLISION_GRID_CELL_SIZE - 5.0f, 110.0f, 20, 10);
+    engine.addComponent(bullet, Team(TeamType::PLAYER));
+    engine.addComponent(bullet, Projectile(shooter, true, 20));
+    // Far from everything
+    Entity other = createCollidable(engine, 1500.0f, 800.0f, 40, 40);
+    engine.addComponent(other, Health(50, 50));
+
+    runCollisionPass(engine, system);
+
+    EXPECT_EQ(engine.getComponentEntity<Health>(enemy)->currentHealth, 30);
+    EXPECT_FALSE(engine.hasComponent<Projectile>(bullet));
+    EXPECT_EQ(engine.getComponentEntity<Health>(other)->currentHealth, 50);
+}
+
+TEST(CollisionSystemCoverage, HitBoxShapesCollideWithoutSprites)
+{
+    gameEngine::GameEngine engine;
+    auto& system = setupCollisionSystem(engine);
+
+    // As on the server: only Transform and a sized HitBox
+    Entity player = engine.createEntity("player");
+    engine.addComponent(player, Transform(100.0f, 100.0f, 0.0f, 2.0f));
+    engine.addComponent(player, HitBox::box(10.0f, 10.0f));
+    engine.addComponent(player, Team(TeamType::PLAYER));
+    // Circle centered 24 units right of its position, scaled to a radius of 8
+    Entity enemy = engine.createEntity("enemy");
+    engine.addComponent(enemy, Transform(100.0f, 110.0f, 0.0f, 2.0f));
+    engine.addComponent(enemy, HitBox::circle(4.0f, 12.0f, 0.0f));
+    engine.addComponent(enemy, Team(TeamType::ENEMY));
+    engine.addComponent(enemy, Health(50, 50));
+    // Its bounding box reaches the player's box (120, 120), its circle does not
+    Entity corner = engine.createEntity("corner");
+    engine.addComponent(corner, Transform(126.0f, 126.0f, 0.0f, 1.0f));
+    engine.addComponent(corner, HitBox::circle(8.0f));
+    engine.addComponent(corner, Team(TeamType::ENEMY));
+    engine.addComponent(corner, Health(50, 50));
+
+    runCollisionPass(engine, system);
+
+    EXPECT_EQ(engine.getComponentEntity<Health>(enemy)->currentHealth, 40);
+    EXPECT_EQ(engine.getComponentEntity<Health>(corner)->currentHealth, 50);
+}
+
+TEST(CollisionSystemCoverage, ProjectileIsSpentByItsFirstHit)
+{
+    gameEngine::GameEngine engine;
+    auto& system = setupCollisionSystem(engine);
+
+    Entity shooter = createCollidable(engine, 1000.0f, 1000.0f, 10, 10);
+    engine.addComponent(shooter, Team(TeamType::PLAYER));
+    Entity first = createCollidable(engine, 100.0f, 100.0f, 40, 40);
+    engine.addComponent(first, Team(TeamType::ENEMY));
+    engine.addComponent(first, Health(20, 20));
+    Entity second = createCollidable(engine, 110.0f, 100.0f, 40, 40);
+    engine.addComponent(second, Team(TeamType::ENEMY));
+    engine.addComponent(second, Health(20, 20));
+    Entity bullet = createCollidable(engine, 120.0f, 110.0f, 10, 10);
+    engine.addComponent(bullet, Team(TeamType::PLAYER));
+    engine.addComponent(bullet, Projectile(shooter, true, 20));
+
+    runCollisionPass(engine, system);
+
+    // The narrow phase reports both hits, the damage step resolves only one
+    const CollisionEvents& events = engine.getResource<CollisionEvents>();
+    ASSERT_EQ(events.collisions.size(), 2u);
+    EXPECT_EQ(events.collisions[0].kind, CollisionKind::PROJECTILE_HIT);
+    ASSERT_EQ(events.hits.size(), 1u);
+    EXPECT_TRUE(events.hits[0].killed);
+    EXPECT_TRUE(events.hits[0].bounty);
+    EXPECT_EQ(engine.getResource<ScoreBoard>().score, static_cast<uint32_t>(ScoreSystem::KILL_BONUS));
+
+    // The spent projectile and the killed enemy are stripped, the other enemy is untouched
+    Entity killed = Entity::fromId(events.hits[0].target);
+    Entity spared = killed == first ? second : first;
+    EXPECT_FALSE(engine.hasComponent<Projectile>(bullet));
+    EXPECT_FALSE(engine.hasComponent<Health>(killed));
+    EXPECT_EQ(engine.getComponentEntity<Health>(spared)->currentHealth, 20);
+}
+
+TEST(CollisionSystemCoverage, LayerMatrixSkipsPairsTeamsRuleOut)
+{
+    Team player(TeamType::PLAYER);
+    Team enemy(TeamType::ENEMY);
+    Team boss(static_cast<uint8_t>(static_cast<uint8_t>(TeamType::BOSS) | static_cast<uint8_t>(TeamType::ENEMY)));
+    const engine::physics::LayerMatrix& layers = CollisionSystem::layerMatrix();
+    auto interacts = [&](const Team& a, bool aIsProjectile, const Team& b, bool bIsProjectile) {
+        return layers.test(CollisionSystem::layerOf(&a, aIsProjectile), CollisionSystem::layerOf(&b, bIsProjectile));
+    };
+
+    EXPECT_FALSE(interacts(player, true, player, false));
+    EXPECT_FALSE(interacts(player, true, player, true));
+    EXPECT_FALSE(interacts(player, true, enemy, true));
+    EXPECT_FALSE(interacts(enemy, false, enemy, false));
+    EXPECT_FALSE(interacts(player, false, player, false));
+    EXPECT_FALSE(layers.any(CollisionSystem::layerOf(nullptr, false)));
+    EXPECT_TRUE(interacts(player, true, enemy, false));
+    EXPECT_TRUE(interacts(boss, false, player, true));
+    EXPECT_TRUE(interacts(enemy, true, player, false));
+    EXPECT_TRUE(interacts(player, false, boss, false));
+}
+
+TEST(CollisionSystemCoverage, FastProjectileHitsTheFirstThinTargetOnItsPath)
+{
+    gameEngine::GameEngine engine;
+    auto& system = setupCollisionSystem(engine);
+
+    Entity shooter = createCollidable(engine, 1000.0f, 1000.0f, 10, 10);
+    engine.addComponent(shooter, Team(TeamType::PLAYER));
+    // Two 4 px wide enemies; the bullet moved 300 px this tick and ended past both
+    Entity near = createCollidable(engine, 200.0f, 100.0f, 4, 40);
+    engine.addComponent(near, Team(TeamType::ENEMY));
+    engine.addComponent(near, Health(50, 50));
+    Entity far = createCollidable(engine, 300.0f, 100.0f, 4, 40);
+    engine.addComponent(far, Team(TeamType::ENEMY));
+    engine.addComponent(far, Health(50, 50));
+    Entity bullet = createCollidable(engine, 400.0f, 110.0f, 10, 10);
+    engine.addComponent(bullet, Team(TeamType::PLAYER));
+    engine.addComponent(bullet, Projectile(shooter, true, 20));
+    engine.addComponent(bullet, Velocity(300.0f / 0.016f, 0.0f));
+
+    runCollisionPass(engine, system);
+
+    const CollisionEvents& events = engine.getResource<CollisionEvents>();
+    ASSERT_EQ(events.collisions.size(), 2u);
+    EXPECT_LT(events.collisions[0].time, events.collisions[1].time);
+    EXPECT_EQ(engine.getComponentEntity<Health>(near)->currentHealth, 30);
+    EXPECT_EQ(engine.getComponentEntity<Health>(far)->currentHealth, 50);
+    EXPECT_FALSE(engine.hasComponent<Projectile>(bullet));
+}
@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** test_frame_arena
+*/
+
+#include <gtest/gtest.h>
+#include <engine/core/FrameArena.hpp>
+
+#include <cstdint>
+#include <vector>
+
+TEST(FrameArenaTest, SteadyStateFramesNoLongerReachUpstream) {
+    FrameArena arena(256);
+
+    for (int frame = 0; frame < 4; ++frame) {
+        std::pmr::vector<std::uint32_t> ids(&arena);
+        for (std::uint32_t i = 0; i < 1000; ++i)
+            ids.push_back(i);
+        std::pmr::vector<double> other(64, 1.0, &arena);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(other.data()) % alignof(double), 0u);
+        arena.reset();
+    }
+    std::size_t chunks = arena.upstreamAllocations();
+
+    // Once the chunks are merged, a frame of the same shape fits in one chunk
+    for (int frame = 0; frame < 4; ++frame) {
+        std::pmr::vector<std::uint32_t> ids(&arena);
+        for (std::uint32_t i = 0; i < 1000; ++i)
+            ids.push_back(i);
+        std::pmr::vector<double> other(64, 1.0, &arena);
+        arena.reset();
+    }
+    EXPECT_EQ(arena.upstreamAllocations(), chunks);
+    EXPECT_EQ(arena.used(), 0u);
+}
+
+TEST(FrameArenaTest, LocalArenaIsResetByNextFrame) {
+    FrameArena& arena = FrameArena::local();
+    void* first = arena.allocate(32, 8);
+    EXPECT_GE(FrameArena::local().used(), 32u);
+    EXPECT_EQ(&FrameArena::local(), &arena);
+
+    FrameArena::nextFrame();
+    EXPECT_EQ(FrameArena::local().used(), 0u);
+    EXPECT_EQ(FrameArena::local().allocate(32, 8), first);
+}
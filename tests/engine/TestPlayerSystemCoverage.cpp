@@ -14,7 +14,7 @@ public:
 
     void addEntity(std::size_t id)
     {
-        _entities.push_back(id);
+        _entities.insert(id);
     }
 };
 
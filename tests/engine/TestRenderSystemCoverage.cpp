@@ -18,7 +18,6 @@ RenderSystem& setupRenderSystem(gameEngine::GameEngine& engine)
     engine.registerComponent<Sprite>();
     engine.registerComponent<Text>();
     engine.registerComponent<ScrollingBackground>();
-    engine.registerComponent<GameConfig>();
 
     auto& system = engine.registerSystem<RenderSystem>(engine);
     engine.setSystemSignature<RenderSystem, Transform, Sprite>();
@@ -88,8 +87,7 @@ TEST(RenderSystemCoverage, HandlesTextOnlyAndNullAssets)
         ZIndex::IS_UI_HUD,
         Transform(50.0f, 60.0f, 0.0f, 1.0f));
 
-    Entity configEntity = engine.createEntity("config");
-    engine.addComponent(configEntity, GameConfig(FontAssets::DEFAULT_FONT, true, true));
+    engine.insertResource<GameConfig>(FontAssets::DEFAULT_FONT, true, true);
 
     system.onUpdate(0.1f);
 
@@ -0,0 +1,100 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** test_spatial_grid
+*/
+
+#include <gtest/gtest.h>
+#include <engine/physics/SpatialGrid.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+using engine::physics::SpatialGrid;
+
+namespace {
+
+struct Box {
+    float left, top, right, bottom;
+};
+
+std::vector<std::pair<std::uint32_t, std::uint32_t>> gridPairs(SpatialGrid& grid, const std::vector<Box>& boxes)
+{
+    grid.clear();
+    for (std::uint32_t i = 0; i < boxes.size(); ++i)
+        grid.insert(i, boxes[i].left, boxes[i].top, boxes[i].right, boxes[i].bottom);
+    grid.build();
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+    grid.forEachPair([&](std::uint32_t a, std::uint32_t b) { pairs.emplace_back(a, b); });
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+} // namespace
+
+TEST(SpatialGridTest, PairsSpanningSeveralCellsAreReportedOnce) {
+    SpatialGrid grid(1920.f, 1080.f, 128.f);
+    std::vector<Box> boxes = {
+        {100.f, 100.f, 300.f, 300.f},       // covers 3x3 cells
+        {200.f, 200.f, 400.f, 400.f},       // shares 4 cells with the first
+        {1000.f, 900.f, 1010.f, 910.f},     // alone
+        {2500.f, -50.f, 2600.f, 10.f},      // off the field, clamped to the top-right cell
+        {1910.f, 0.f, 1920.f, 20.f},
+    };
+
+    auto pairs = gridPairs(grid, boxes);
+
+    EXPECT_EQ(pairs, (std::vector<std::pair<std::uint32_t, std::uint32_t>>{{0, 1}, {3, 4}}));
+}
+
+TEST(SpatialGridTest, FindsEveryOverlappingPairOfARandomField) {
+    SpatialGrid grid(1920.f, 1080.f, 128.f);
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> x(-100.f, 2000.f);
+    std::uniform_real_distribution<float> y(-100.f, 1150.f);
+    std::uniform_real_distribution<float> size(4.f, 200.f);
+    std::vector<Box> boxes;
+    for (int i = 0; i < 400; ++i) {
+        float left = x(rng);
+        float top = y(rng);
+        boxes.push_back({left, top, left + size(rng), top + size(rng)});
+    }
+
+    auto candidates = gridPairs(grid, boxes);
+    auto unique = candidates;
+    unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+    EXPECT_EQ(unique.size(), candidates.size());
+
+    for (std::uint32_t a = 0; a < boxes.size(); ++a) {
+        for (std::uint32_t b = a + 1; b < boxes.size(); ++b) {
+            bool overlap = boxes[a].left < boxes[b].right && boxes[b].left < boxes[a].right
+                && boxes[a].top < boxes[b].bottom && boxes[b].top < boxes[a].bottom;
+            if (overlap)
+                EXPECT_TRUE(std::binary_search(candidates.begin(), candidates.end(), std::make_pair(a, b)));
+        }
+    }
+}
+
+TEST(SpatialGridTest, LayerMatrixDropsPairsThatNeverInteract) {
+    SpatialGrid grid(1920.f, 1080.f, 128.f);
+    engine::physics::LayerMatrix layers;
+    layers.set(1, 2);
+    grid.setLayerMatrix(&layers);
+
+    // Four overlapping boxes: layers 1 and 2 interact, 1 with 1 does not, 3 with nothing
+    grid.clear();
+    grid.insert(0, 0.f, 0.f, 50.f, 50.f, 1);
+    grid.insert(1, 10.f, 10.f, 60.f, 60.f, 1);
+    grid.insert(2, 20.f, 20.f, 70.f, 70.f, 2);
+    grid.insert(3, 30.f, 30.f, 80.f, 80.f, 3);
+    grid.build();
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+    grid.forEachPair([&](std::uint32_t a, std::uint32_t b) { pairs.emplace_back(std::min(a, b), std::max(a, b)); });
+    std::sort(pairs.begin(), pairs.end());
+
+    EXPECT_EQ(pairs, (std::vector<std::pair<std::uint32_t, std::uint32_t>>{{0, 2}, {1, 2}}));
+}
@@ -623,8 +623,9 @@ TEST_F(CoordinatorFixture, CreateScoreEntity_SetsHudAndComponents)
     EXPECT_TRUE(eng->getComponentEntity<Score>(scoreEntity).has_value());
     EXPECT_TRUE(eng->getComponentEntity<Text>(scoreEntity).has_value());
 
-    auto& scoreSystem = eng->getSystem<ScoreSystem>();
-    EXPECT_EQ(scoreSystem._hud, scoreEntity);
+    auto& board = eng->getResource<ScoreBoard>();
+    EXPECT_EQ(board.hud, scoreEntity);
+    EXPECT_EQ(board.score, 300u);
 }
 
 TEST_F(CoordinatorFixture, SetupScoreEntity_UpdatesExistingComponents)
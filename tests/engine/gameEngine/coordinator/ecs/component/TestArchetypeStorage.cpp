@@ -0,0 +1,138 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** test_archetype_storage
+*/
+
+#include <gtest/gtest.h>
+#include <engine/ecs/component/ArchetypeStorage.hpp>
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/component/Components.hpp>
+
+#include <memory>
+#include <string>
+
+namespace {
+
+constexpr std::size_t POSITION = 0;
+constexpr std::size_t NAME = 1;
+
+struct Position {
+    float x;
+    float y;
+};
+
+class MoverSystem : public System {};
+
+} // namespace
+
+TEST(ArchetypeStorageTest, AddAndRemoveMoveRowsKeepingValues) {
+    ArchetypeStorage storage;
+
+    storage.emplace<Position>(1, POSITION, Position{1.f, 2.f});
+    storage.emplace<std::string>(1, NAME, "ship");
+    EXPECT_EQ(storage.archetypeCount(), 2u);
+    ASSERT_NE(storage.tryGet<Position>(1, POSITION), nullptr);
+    EXPECT_FLOAT_EQ(storage.tryGet<Position>(1, POSITION)->y, 2.f);
+    EXPECT_EQ(*storage.tryGet<std::string>(1, NAME), "ship");
+
+    storage.remove(1, POSITION);
+    EXPECT_FALSE(storage.contains(1, POSITION));
+    EXPECT_EQ(storage.tryGet<Position>(1, POSITION), nullptr);
+    EXPECT_EQ(*storage.tryGet<std::string>(1, NAME), "ship");
+
+    storage.remove(1, NAME);
+    EXPECT_FALSE(storage.contains(1, NAME));
+}
+
+TEST(ArchetypeStorageTest, EraseMovesLastRowIntoTheHole) {
+    ArchetypeStorage storage;
+    for (std::size_t e = 1; e <= 3; ++e)
+        storage.emplace<Position>(e, POSITION, Position{static_cast<float>(e), 0.f});
+
+    storage.erase(1);
+
+    EXPECT_FALSE(storage.contains(1, POSITION));
+    EXPECT_FLOAT_EQ(storage.tryGet<Position>(2, POSITION)->x, 2.f);
+    EXPECT_FLOAT_EQ(storage.tryGet<Position>(3, POSITION)->x, 3.f);
+    EXPECT_EQ(storage.count(std::array<std::size_t, 1>{POSITION}), 2u);
+}
+
+TEST(ArchetypeStorageTest, EachWalksEveryChunkOfMatchingArchetypes) {
+    ArchetypeStorage storage;
+    constexpr std::size_t COUNT = 3 * ArchetypeStorage::CHUNK_SIZE / sizeof(Position);
+    for (std::size_t e = 0; e < COUNT; ++e) {
+        storage.emplace<Position>(e, POSITION, Position{1.f, 0.f});
+        if (e % 2 == 0)
+            storage.emplace<std::string>(e, NAME, "named");
+    }
+    EXPECT_GT(storage.chunkCount(), 3u);
+
+    std::size_t visited = 0;
+    float sum = 0.f;
+    storage.each<Position>({POSITION}, [&](std::size_t, Position& p) {
+        ++visited;
+        sum += p.x;
+    });
+    EXPECT_EQ(visited, COUNT);
+    EXPECT_FLOAT_EQ(sum, static_cast<float>(COUNT));
+
+    std::size_t named = 0;
+    storage.each<Position, std::string>({POSITION, NAME}, [&](std::size_t e, Position&, std::string& s) {
+        EXPECT_EQ(e % 2, 0u);
+        EXPECT_EQ(s, "named");
+        ++named;
+    });
+    EXPECT_EQ(named, (COUNT + 1) / 2);
+}
+
+TEST(ArchetypeStorageTest, DestroysLiveComponents) {
+    auto tracker = std::make_shared<int>(0);
+    {
+        ArchetypeStorage storage;
+        storage.emplace<std::shared_ptr<int>>(1, POSITION, tracker);
+        storage.emplace<std::shared_ptr<int>>(2, POSITION, tracker);
+        storage.erase(1);
+        EXPECT_EQ(tracker.use_count(), 2);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(ArchetypeStorageTest, EntityManagerArchetypeModeDrivesViewsAndSystems) {
+    EntityManager em(StorageMode::ARCHETYPE);
+    SystemManager sm;
+    em.setSystemManager(&sm);
+
+    auto& mover = sm.addSystem<MoverSystem>();
+    Signature sig;
+    sig.set(em.getComponentTypeId<Transform>());
+    sig.set(em.getComponentTypeId<Velocity>());
+    sm.setSignature<MoverSystem>(sig);
+
+    Entity moving = em.spawnEntity("moving");
+    em.emplaceComponent<Transform>(moving, 0.f, 0.f, 0.f, 1.f);
+    em.emplaceComponent<Velocity>(moving, 2.f, 3.f);
+    Entity still = em.spawnEntity("still");
+    em.emplaceComponent<Transform>(still, 5.f, 5.f, 0.f, 1.f);
+
+    EXPECT_TRUE(mover.hasEntity(moving));
+    EXPECT_FALSE(mover.hasEntity(still));
+    EXPECT_THROW(em.getComponents<Transform>(), Error);
+
+    em.view<Transform, Velocity>().each([](size_t, Transform& t, Velocity& v) {
+        t.x += v.vx;
+    });
+    EXPECT_FLOAT_EQ(em.tryGetComponent<Transform>(moving)->x, 2.f);
+    EXPECT_FLOAT_EQ(em.tryGetComponent<Transform>(still)->x, 5.f);
+
+    em.removeComponent<Velocity>(moving);
+    EXPECT_FALSE(em.hasComponent<Velocity>(moving));
+    EXPECT_FALSE(mover.hasEntity(moving));
+    EXPECT_FLOAT_EQ(em.tryGetComponent<Transform>(moving)->x, 2.f);
+
+    em.killEntity(moving);
+    EXPECT_EQ(em.tryGetComponent<Transform>(moving), nullptr);
+    EXPECT_EQ(em.view<Transform>().size(), 1u);
+}
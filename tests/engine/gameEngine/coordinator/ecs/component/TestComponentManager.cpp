@@ -67,4 +67,98 @@ TEST(ComponentManagerTest, Iteration) {
     }
 
     EXPECT_EQ(count, 3);
-}
\ No newline at end of file
+}
+TEST(ComponentManagerTest, ReadDoesNotGrow) {
+    ComponentManager<Health> mgr;
+
+    EXPECT_FALSE(mgr[10050].has_value());
+    EXPECT_EQ(mgr.size(), 0);
+    EXPECT_EQ(mgr.packedSize(), 0);
+}
+
+TEST(ComponentManagerTest, AbsentLookupsShareTheReadOnlyEmptySlot) {
+    ComponentManager<Health> mgr;
+    ComponentManager<Health> other;
+    const ComponentManager<Health>& constMgr = mgr;
+
+    mgr.emplaceAt(3, 10, 10);
+
+    EXPECT_EQ(&mgr[7], &constMgr[7]);
+    EXPECT_EQ(&mgr[7], &other[7]);
+    EXPECT_FALSE(mgr[7].has_value());
+    EXPECT_NE(&mgr[3], &mgr[7]);
+}
+
+TEST(ComponentManagerTest, SparseIdsArePacked) {
+    ComponentManager<Health> mgr;
+
+    mgr.emplaceAt(3, 30, 30);
+    mgr.emplaceAt(10000, 10, 10);
+
+    EXPECT_EQ(mgr.size(), 10001);
+    EXPECT_EQ(mgr.packedSize(), 2);
+    EXPECT_TRUE(mgr.contains(10000));
+    EXPECT_FALSE(mgr.contains(9999));
+    ASSERT_NE(mgr.tryGet(10000), nullptr);
+    EXPECT_EQ(mgr.tryGet(10000)->current, 10);
+}
+
+TEST(ComponentManagerTest, EraseSwapsLastIntoHole) {
+    ComponentManager<Health> mgr;
+
+    mgr.emplaceAt(1, 1, 1);
+    mgr.emplaceAt(2, 2, 2);
+    mgr.emplaceAt(3, 3, 3);
+
+    mgr.erase(1);
+
+    EXPECT_EQ(mgr.packedSize(), 2);
+    EXPECT_FALSE(mgr[1].has_value());
+    ASSERT_TRUE(mgr[3].has_value());
+    EXPECT_EQ(mgr[3]->current, 3);
+    EXPECT_EQ(mgr.packedEntities()[0], 3u);
+    EXPECT_EQ(mgr.getIndex(mgr[2]), 2u);
+}
+
+TEST(ComponentManagerTest, ForEachVisitsLiveComponents) {
+    ComponentManager<Health> mgr;
+
+    mgr.emplaceAt(7, 7, 7);
+    mgr.emplaceAt(10007, 5, 5);
+    mgr.erase(7);
+
+    size_t visited = 0;
+    mgr.forEach([&](size_t entity, Health& h) {
+        EXPECT_EQ(entity, 10007u);
+        EXPECT_EQ(h.current, 5);
+        visited++;
+    });
+
+    EXPECT_EQ(visited, 1);
+}
+
+TEST(ComponentManagerTest, ChangeTicksFollowWritesAndSwaps) {
+    auto clock = std::make_shared<std::uint32_t>(1);
+    ComponentManager<Health> mgr;
+    mgr.setChangeClock(clock);
+
+    mgr.emplaceAt(1, 1, 1);
+    mgr.emplaceAt(2, 2, 2);
+    *clock = 2;
+    mgr.emplaceAt(3, 3, 3);
+    *clock = 3;
+    mgr.markChanged(1);
+    mgr.markChanged(42);
+
+    EXPECT_EQ(mgr.changeTick(1), 3u);
+    EXPECT_EQ(mgr.changeTick(2), 1u);
+    EXPECT_EQ(mgr.changeTick(42), ComponentManager<Health>::NEVER_CHANGED);
+
+    // The last component keeps its tick when it is moved into a hole
+    mgr.erase(2);
+    EXPECT_EQ(mgr.changeTick(3), 2u);
+
+    std::vector<size_t> changed;
+    mgr.forEachChangedSince(1, [&](size_t entity, Health&) { changed.push_back(entity); });
+    EXPECT_EQ(changed, (std::vector<size_t>{1, 3}));
+}
@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** test_view
+*/
+
+#include <gtest/gtest.h>
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/component/Components.hpp>
+
+#include <set>
+
+namespace {
+
+class MoverSystem : public System {};
+
+std::set<size_t> collect(View<Transform, Velocity> view)
+{
+    std::set<size_t> ids;
+    view.each([&](size_t e, Transform&, Velocity&) { ids.insert(e); });
+    return ids;
+}
+
+} // namespace
+
+class ViewTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        em.registerComponent<Transform>();
+        em.registerComponent<Velocity>();
+
+        moving = em.spawnEntity("moving");
+        em.emplaceComponent<Transform>(moving, 0.f, 0.f, 0.f, 1.f);
+        em.emplaceComponent<Velocity>(moving, 2.f, 3.f);
+
+        still = em.spawnEntity("still");
+        em.emplaceComponent<Transform>(still, 5.f, 5.f, 0.f, 1.f);
+    }
+
+    EntityManager em;
+    Entity moving = Entity::fromId(0);
+    Entity still = Entity::fromId(0);
+};
+
+TEST_F(ViewTest, WithoutSystemManagerFiltersSmallestPool) {
+    auto view = em.view<Transform, Velocity>();
+
+    EXPECT_EQ(view.size(), 1u);
+    EXPECT_EQ(collect(view), std::set<size_t>{moving});
+}
+
+TEST_F(ViewTest, EachHandsOutMutableReferences) {
+    em.view<Transform, Velocity>().each([](size_t, Transform& t, Velocity& v) {
+        t.x += v.vx;
+        t.y += v.vy;
+    });
+
+    EXPECT_FLOAT_EQ(em.getComponent<Transform>(moving)->x, 2.f);
+    EXPECT_FLOAT_EQ(em.getComponent<Transform>(moving)->y, 3.f);
+    EXPECT_FLOAT_EQ(em.getComponent<Transform>(still)->x, 5.f);
+}
+
+TEST_F(ViewTest, CachedMatchListFollowsSignatureChanges) {
+    SystemManager sm;
+    em.setSystemManager(&sm);
+
+    EXPECT_EQ(collect(em.view<Transform, Velocity>()), std::set<size_t>{moving});
+
+    em.emplaceComponent<Velocity>(still, 1.f, 1.f);
+    EXPECT_EQ(collect(em.view<Transform, Velocity>()), (std::set<size_t>{moving, still}));
+
+    em.removeComponent<Velocity>(moving);
+    em.killEntity(still);
+    EXPECT_TRUE(collect(em.view<Transform, Velocity>()).empty());
+}
+
+TEST_F(ViewTest, ReusesSystemMatchListWithSameSignature) {
+    SystemManager sm;
+    em.setSystemManager(&sm);
+    auto& system = sm.addSystem<MoverSystem>();
+    Signature sig;
+    sig.set(em.getComponentTypeId<Transform>());
+    sig.set(em.getComponentTypeId<Velocity>());
+    sm.setSignature<MoverSystem>(sig);
+
+    Entity other = em.spawnEntity("other");
+    em.emplaceComponent<Transform>(other, 0.f, 0.f, 0.f, 1.f);
+    em.emplaceComponent<Velocity>(other, 0.f, 0.f);
+
+    auto view = em.view<Transform, Velocity>();
+    EXPECT_EQ(view.size(), system.entityCount());
+    EXPECT_EQ(collect(view), std::set<size_t>{other});
+}
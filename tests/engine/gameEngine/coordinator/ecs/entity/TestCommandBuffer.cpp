@@ -0,0 +1,177 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** test_command_buffer
+*/
+
+#include <gtest/gtest.h>
+#include <engine/ecs/entity/CommandBuffer.hpp>
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/component/Components.hpp>
+
+namespace {
+
+class MovingSystem : public System {};
+
+class KillingSystem : public System {
+public:
+    explicit KillingSystem(CommandBuffer& commands) : _commands(commands) {}
+
+    void onUpdate(float) override
+    {
+        for (size_t e : _entities)
+            _commands.kill(Entity::fromId(e));
+        seen = entityCount();
+    }
+
+    size_t seen = 0;
+
+private:
+    CommandBuffer& _commands;
+};
+
+template <int N>
+class HealingSystem : public System {
+public:
+    HealingSystem(CommandBuffer& commands, Entity target) : _commands(commands), _target(target) {}
+
+    void onUpdate(float) override
+    {
+        _commands.add<Health>(_target, Health(N, N));
+    }
+
+private:
+    CommandBuffer& _commands;
+    Entity _target;
+};
+
+} // namespace
+
+class CommandBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        em.registerComponent<Transform>();
+        em.registerComponent<Velocity>();
+        em.setSystemManager(&sm);
+
+        sm.addSystem<MovingSystem>();
+        Signature sig;
+        sig.set(em.getComponentTypeId<Transform>());
+        sig.set(em.getComponentTypeId<Velocity>());
+        sm.setSignature<MovingSystem>(sig);
+    }
+
+    EntityManager em;
+    SystemManager sm;
+    CommandBuffer commands{em};
+};
+
+TEST_F(CommandBufferTest, CommandsAreDeferredUntilFlush) {
+    Entity e = commands.spawn("deferred");
+    commands.add(e, Transform(1.f, 2.f, 0.f, 1.f));
+    commands.add(e, Velocity(3.f, 4.f));
+
+    EXPECT_TRUE(em.isAlive(e));
+    EXPECT_FALSE(em.hasComponent<Transform>(e));
+    EXPECT_FALSE(sm.getSystem<MovingSystem>().hasEntity(e));
+    EXPECT_EQ(commands.size(), 2u);
+
+    commands.flush();
+
+    EXPECT_TRUE(commands.empty());
+    EXPECT_TRUE(em.hasComponent<Transform>(e));
+    EXPECT_TRUE(em.hasComponent<Velocity>(e));
+    EXPECT_TRUE(sm.getSystem<MovingSystem>().hasEntity(e));
+}
+
+TEST_F(CommandBufferTest, RemoveAndKillLeaveSystems) {
+    Entity e1 = em.spawnEntity("first");
+    em.emplaceComponent<Transform>(e1, 0.f, 0.f, 0.f, 1.f);
+    em.emplaceComponent<Velocity>(e1, 0.f, 0.f);
+    Entity e2 = em.spawnEntity("second");
+    em.emplaceComponent<Transform>(e2, 0.f, 0.f, 0.f, 1.f);
+    em.emplaceComponent<Velocity>(e2, 0.f, 0.f);
+
+    commands.remove<Velocity>(e1);
+    commands.kill(e2);
+    EXPECT_EQ(sm.getSystem<MovingSystem>().entityCount(), 2u);
+
+    commands.flush();
+
+    EXPECT_TRUE(em.isAlive(e1));
+    EXPECT_TRUE(em.hasComponent<Transform>(e1));
+    EXPECT_FALSE(em.hasComponent<Velocity>(e1));
+    EXPECT_FALSE(em.isAlive(e2));
+    EXPECT_EQ(sm.getSystem<MovingSystem>().entityCount(), 0u);
+}
+
+TEST_F(CommandBufferTest, CommandsOnKilledEntityAreDropped) {
+    Entity e = em.spawnEntity("victim");
+    em.emplaceComponent<Transform>(e, 0.f, 0.f, 0.f, 1.f);
+
+    commands.kill(e);
+    commands.kill(e);
+    commands.remove<Transform>(e);
+    commands.add(e, Velocity(1.f, 1.f));
+
+    EXPECT_NO_THROW(commands.flush());
+    EXPECT_FALSE(em.isAlive(e));
+    EXPECT_EQ(em.getComponents<Velocity>().packedSize(), 0u);
+}
+
+TEST_F(CommandBufferTest, HeldSignatureUpdatesAreCoalesced) {
+    Entity e = em.spawnEntity("batched");
+
+    em.holdSignatureUpdates();
+    em.emplaceComponent<Transform>(e, 0.f, 0.f, 0.f, 1.f);
+    em.emplaceComponent<Velocity>(e, 0.f, 0.f);
+    EXPECT_FALSE(sm.getSystem<MovingSystem>().hasEntity(e));
+
+    em.releaseSignatureUpdates();
+    EXPECT_TRUE(sm.getSystem<MovingSystem>().hasEntity(e));
+}
+
+TEST_F(CommandBufferTest, UpdateAllFlushesAfterEachSystem) {
+    auto& killer = sm.addSystem<KillingSystem>(commands);
+    Signature sig;
+    sig.set(em.getComponentTypeId<Transform>());
+    sm.setSignature<KillingSystem>(sig);
+    sm.setSyncPoint([this]() { commands.flush(); });
+
+    Entity e = em.spawnEntity("doomed");
+    em.emplaceComponent<Transform>(e, 0.f, 0.f, 0.f, 1.f);
+
+    sm.updateAll(0.016f);
+
+    EXPECT_EQ(killer.seen, 1u);
+    EXPECT_TRUE(commands.empty());
+    EXPECT_FALSE(em.isAlive(e));
+    EXPECT_EQ(killer.entityCount(), 0u);
+}
+
+TEST_F(CommandBufferTest, ParallelSystemsFlushInSystemOrder) {
+    em.registerComponent<Health>();
+    Entity e = em.spawnEntity("target");
+
+    sm.setSchedulerMode(SchedulerMode::PARALLEL, 4);
+    sm.addSystem<HealingSystem<1>>(commands, e);
+    sm.addSystem<HealingSystem<2>>(commands, e);
+    sm.addSystem<HealingSystem<3>>(commands, e);
+    Signature none;
+    sm.setSignature<HealingSystem<1>>(none);
+    sm.setSignature<HealingSystem<2>>(none);
+    sm.setSignature<HealingSystem<3>>(none);
+    sm.setReads<HealingSystem<1>>(none);
+    sm.setReads<HealingSystem<2>>(none);
+    sm.setReads<HealingSystem<3>>(none);
+    sm.setSyncPoint([this]() { commands.flush(); });
+    ASSERT_EQ(sm.getBatches().size(), 2u);
+
+    for (int frame = 0; frame < 50; ++frame) {
+        em.removeComponent<Health>(e);
+        sm.updateAll(0.016f);
+        ASSERT_EQ(em.getComponent<Health>(e)->currentHealth, 3);
+    }
+}
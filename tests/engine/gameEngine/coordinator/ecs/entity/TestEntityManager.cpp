@@ -9,6 +9,9 @@
 #include <engine/ecs/entity/EntityManager.hpp>
 #include <engine/ecs/component/Components.hpp>
 
+#include <string>
+#include <vector>
+
 // Test Fixture
 class EntityManagerTest : public ::testing::Test {
 protected:
@@ -88,4 +91,145 @@ TEST_F(EntityManagerTest, EntityRecycling) {
 
     // L'ID devrait être recyclé
     EXPECT_EQ(id1, id2);
-}
\ No newline at end of file
+}
+TEST_F(EntityManagerTest, KillEntityErasesOwnedComponents) {
+    Entity e1 = em.spawnEntity("First");
+    em.emplaceComponent<Transform>(e1, 1.f, 2.f, 0.f, 1.f);
+    em.emplaceComponent<Velocity>(e1, 3.f, 4.f);
+
+    em.killEntity(e1);
+
+    Entity e2 = em.spawnEntity("Second");
+    ASSERT_EQ(static_cast<size_t>(e1), static_cast<size_t>(e2));
+    EXPECT_FALSE(em.hasComponent<Transform>(e2));
+    EXPECT_FALSE(em.hasComponent<Velocity>(e2));
+    EXPECT_EQ(em.getComponents<Transform>().packedSize(), 0u);
+}
+
+TEST_F(EntityManagerTest, ComponentTypeIdMatchesSignatureBit) {
+    Entity e = em.spawnEntity("TestEntity");
+    em.emplaceComponent<Velocity>(e, 1.f, 2.f);
+
+    Signature sig = em.getSignature(e);
+    EXPECT_TRUE(sig.test(em.getComponentTypeId<Velocity>()));
+    EXPECT_FALSE(sig.test(em.getComponentTypeId<Transform>()));
+}
+
+TEST_F(EntityManagerTest, StaleHandleStaysDeadAfterRecycling) {
+    Entity stale = em.spawnEntity("First");
+    em.killEntity(stale);
+    Entity fresh = em.spawnEntity("Second");
+
+    ASSERT_EQ(static_cast<size_t>(stale), static_cast<size_t>(fresh));
+    EXPECT_NE(stale.getGeneration(), fresh.getGeneration());
+    EXPECT_FALSE(em.isAlive(stale));
+    EXPECT_TRUE(em.isAlive(fresh));
+    EXPECT_TRUE(em.isAlive(Entity::fromId(fresh)));
+    EXPECT_THROW(em.emplaceComponent<Velocity>(stale, 1.f, 1.f), Error);
+
+    em.killEntity(stale);
+    EXPECT_TRUE(em.isAlive(fresh));
+    EXPECT_EQ(em.getEntityFromDirectID(fresh).getGeneration(), fresh.getGeneration());
+}
+
+TEST_F(EntityManagerTest, DenseEntityListsFollowSpawnAndKill) {
+    Entity a = em.spawnEntity("a");
+    Entity b = em.spawnEntity("b");
+    Entity c = em.spawnEntity("c");
+    Entity net = em.spawnEntity("net", EntityCategory::NETWORKED);
+
+    em.killEntity(a);
+
+    EXPECT_EQ(em.getLocalEntities(), (std::vector<size_t>{static_cast<size_t>(c), static_cast<size_t>(b)}));
+    EXPECT_EQ(em.getNetworkedEntities(), (std::vector<size_t>{static_cast<size_t>(net)}));
+    EXPECT_TRUE(EntityManager::isNetworkedId(net));
+
+    em.killEntity(net);
+    EXPECT_TRUE(em.getNetworkedEntities().empty());
+    EXPECT_THROW(em.spawnEntityWithId(b, "dup", EntityCategory::LOCAL), Error);
+}
+
+TEST_F(EntityManagerTest, ChangedSinceReportsWritesAfterTheTick) {
+    Entity still = em.spawnEntity("still");
+    Entity moved = em.spawnEntity("moved");
+    em.emplaceComponent<Transform>(still, 0.f, 0.f, 0.f, 1.f);
+    em.emplaceComponent<Transform>(moved, 0.f, 0.f, 0.f, 1.f);
+
+    std::uint32_t seen = em.getChangeTick();
+    em.advanceChangeTick();
+
+    em.tryGetComponent<Transform>(moved)->x = 5.f;
+    em.markDirty<Transform>(moved);
+    em.tryGetComponent<Transform>(still)->x = 1.f;  // not marked: invisible to change tracking
+
+    std::vector<size_t> changed;
+    em.forEachChangedSince<Transform>(seen, [&](size_t id, Transform&) { changed.push_back(id); });
+    EXPECT_EQ(changed, (std::vector<size_t>{static_cast<size_t>(moved)}));
+
+    em.updateComponent<Transform>(still, Transform(2.f, 0.f, 0.f, 1.f));
+    changed.clear();
+    em.forEachChangedSince<Transform>(seen, [&](size_t id, Transform&) { changed.push_back(id); });
+    EXPECT_EQ(changed.size(), 2u);
+}
+
+TEST_F(EntityManagerTest, ObserversSeeAddSetAndRemove) {
+    std::vector<std::string> events;
+    em.onAdd<Transform>([&](Entity, Transform& t) { events.push_back("add " + std::to_string(static_cast<int>(t.x))); });
+    em.onSet<Transform>([&](Entity, Transform& t) { events.push_back("set " + std::to_string(static_cast<int>(t.x))); });
+    em.onRemove<Transform>([&](Entity e, Transform& t) {
+        EXPECT_TRUE(em.isAlive(e));
+        events.push_back("remove " + std::to_string(static_cast<int>(t.x)));
+    });
+
+    Entity e = em.spawnEntity("e");
+    em.emplaceComponent<Transform>(e, 1.f, 0.f, 0.f, 1.f);
+    em.addComponent<Transform>(e, Transform(2.f, 0.f, 0.f, 1.f));
+    em.updateComponent<Transform>(e, Transform(3.f, 0.f, 0.f, 1.f));
+    em.removeComponent<Transform>(e);
+    em.removeComponent<Transform>(e);  // not owned anymore: no event
+    em.emplaceComponent<Velocity>(e, 1.f, 1.f);  // not observed
+
+    Entity killed = em.spawnEntity("killed");
+    em.emplaceComponent<Transform>(killed, 4.f, 0.f, 0.f, 1.f);
+    em.killEntity(killed);
+
+    EXPECT_EQ(events, (std::vector<std::string>{"add 1", "set 2", "set 3", "remove 3", "add 4", "remove 4"}));
+}
+
+TEST_F(EntityManagerTest, EntityNamesAreInternedOnce) {
+    Entity first = em.spawnEntity("Projectile");
+    std::size_t interned = NameTable::size();
+    Entity second = em.spawnEntity(std::string("Projectile"));
+    em.killEntity(first);
+    Entity third = em.spawnEntity("Projectile");
+
+    EXPECT_EQ(NameTable::size(), interned);
+    EXPECT_EQ(EntityName("Projectile"), EntityName(std::string_view("Projectile")));
+    if constexpr (EntityName::ENABLED) {
+        EXPECT_EQ(em.getEntityName(second), "Projectile");
+        EXPECT_EQ(em.getEntityName(third), "Projectile");
+        EXPECT_NE(EntityName("Projectile"), EntityName("Enemy"));
+    } else {
+        EXPECT_EQ(em.getEntityName(second), "");
+    }
+    EXPECT_EQ(EntityName().view(), "");
+}
+
+TEST_F(EntityManagerTest, ResourcesAreSingletonsOutsideThePools) {
+    EXPECT_EQ(em.tryGetResource<ScoreBoard>(), nullptr);
+    EXPECT_THROW(em.getResource<ScoreBoard>(), Error);
+
+    em.insertResource<ScoreBoard>().score = 10;
+    ScoreBoard* board = em.tryGetResource<ScoreBoard>();
+    ASSERT_NE(board, nullptr);
+    EXPECT_EQ(board, &em.getResource<ScoreBoard>());
+    EXPECT_EQ(board->score, 10u);
+
+    // Inserting again replaces the instance
+    em.insertResource<ScoreBoard>(ScoreBoard{42, {1}, Entity::fromId(3)});
+    EXPECT_EQ(em.getResource<ScoreBoard>().score, 42u);
+    EXPECT_EQ(em.getLocalEntities().size(), 0u);
+
+    em.removeResource<ScoreBoard>();
+    EXPECT_FALSE(em.hasResource<ScoreBoard>());
+}
@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** test_prefab
+*/
+
+#include <gtest/gtest.h>
+#include <engine/ecs/entity/Prefab.hpp>
+#include <engine/ecs/entity/PrefabRegistry.hpp>
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/component/Components.hpp>
+
+#include <vector>
+
+namespace {
+
+class MoverSystem : public System {};
+
+} // namespace
+
+TEST(PrefabTest, SpawnEntitiesRecyclesFreeIdsFirst) {
+    EntityManager em;
+    Entity a = em.spawnEntity("a");
+    Entity b = em.spawnEntity("b");
+    em.killEntity(a);
+
+    std::vector<Entity> batch = em.spawnEntities(3, "wave", EntityCategory::NETWORKED);
+    std::vector<Entity> local = em.spawnEntities(2, "bullet");
+
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_EQ(static_cast<size_t>(batch[0]), NETWORKED_ID_OFFSET);
+    EXPECT_EQ(static_cast<size_t>(batch[2]), NETWORKED_ID_OFFSET + 2);
+    EXPECT_EQ(static_cast<size_t>(local[0]), static_cast<size_t>(a));
+    EXPECT_EQ(static_cast<size_t>(local[1]), static_cast<size_t>(b) + 1);
+    EXPECT_FALSE(em.isAlive(a));
+    for (const Entity& e : batch) {
+        EXPECT_TRUE(em.isAlive(e));
+        EXPECT_EQ(em.getEntityName(e), "wave");
+    }
+    EXPECT_EQ(em.getNetworkedEntities().size(), 3u);
+    EXPECT_EQ(em.getLocalEntities().size(), 3u);
+}
+
+TEST(PrefabTest, ApplyWritesEveryComponentAndMatchesSystems) {
+    EntityManager em;
+    SystemManager sm;
+    em.setSystemManager(&sm);
+    em.registerComponent<Transform>();
+    em.registerComponent<Velocity>();
+    em.registerComponent<Team>();
+
+    auto& mover = sm.addSystem<MoverSystem>();
+    Signature sig;
+    sig.set(em.getComponentTypeId<Transform>());
+    sig.set(em.getComponentTypeId<Velocity>());
+    sm.setSignature<MoverSystem>(sig);
+
+    Prefab bullet("bullet");
+    bullet.with(Transform(0.f, 0.f, 0.f, 1.f)).with(Velocity(8.f, 0.f)).with(Velocity(4.f, 0.f)).with<Team>(TeamType::PLAYER);
+    EXPECT_EQ(bullet.size(), 3u);
+
+    em.holdSignatureUpdates();
+    std::vector<Entity> entities = em.spawnEntities(100, bullet.getName());
+    bullet.apply(em, entities);
+    EXPECT_EQ(mover.entityCount(), 0u);
+    em.releaseSignatureUpdates();
+
+    EXPECT_EQ(mover.entityCount(), 100u);
+    EXPECT_EQ(em.getComponents<Velocity>().packedSize(), 100u);
+    EXPECT_FLOAT_EQ(em.tryGetComponent<Velocity>(entities[42])->vx, 4.f);
+    EXPECT_EQ(em.tryGetComponent<Team>(entities[99])->teamMask, static_cast<uint8_t>(TeamType::PLAYER));
+}
+
+TEST(PrefabTest, AddComponentsRejectsDeadEntitiesBeforeWriting) {
+    EntityManager em;
+    em.registerComponent<Velocity>();
+    std::vector<Entity> entities = em.spawnEntities(3, "e");
+    em.killEntity(entities[1]);
+
+    EXPECT_THROW(em.addComponents(std::span<const Entity>(entities), Velocity(1.f, 1.f)), Error);
+    EXPECT_EQ(em.getComponents<Velocity>().packedSize(), 0u);
+}
+
+TEST(PrefabTest, KillEntitiesSkipsStaleHandles) {
+    EntityManager em;
+    SystemManager sm;
+    em.setSystemManager(&sm);
+    em.registerComponent<Velocity>();
+    auto& mover = sm.addSystem<MoverSystem>();
+    Signature sig;
+    sig.set(em.getComponentTypeId<Velocity>());
+    sm.setSignature<MoverSystem>(sig);
+
+    std::vector<Entity> first = em.spawnEntities(4, "first");
+    em.addComponents(std::span<const Entity>(first), Velocity(1.f, 0.f));
+    em.killEntity(first[0]);
+    Entity reused = em.spawnEntity("reused");
+    ASSERT_EQ(static_cast<size_t>(reused), static_cast<size_t>(first[0]));
+
+    em.killEntities(first);
+
+    EXPECT_TRUE(em.isAlive(reused));
+    EXPECT_EQ(em.getLocalEntities().size(), 1u);
+    EXPECT_EQ(mover.entityCount(), 0u);
+    EXPECT_EQ(em.getComponents<Velocity>().packedSize(), 0u);
+}
+
+TEST(PrefabTest, SignatureAndDefaultsAreComputedOnce) {
+    Prefab enemy("enemy", EntityCategory::NETWORKED);
+    enemy.with(Velocity(-2.f, 0.f)).with(Health(50, 50)).with(Health(30, 30));
+
+    Signature expected;
+    expected.set(EntityManager::getComponentTypeId<Velocity>());
+    expected.set(EntityManager::getComponentTypeId<Health>());
+    EXPECT_EQ(enemy.getSignature(), expected);
+    EXPECT_EQ(enemy.getCategory(), EntityCategory::NETWORKED);
+    ASSERT_NE(enemy.get<Health>(), nullptr);
+    EXPECT_EQ(enemy.get<Health>()->maxHp, 30);
+    EXPECT_EQ(enemy.get<Transform>(), nullptr);
+
+    // Copies share the immutable defaults
+    Prefab copy = enemy;
+    EXPECT_EQ(copy.get<Velocity>(), enemy.get<Velocity>());
+}
+
+TEST(PrefabTest, RegistryStoresPrefabsByKey) {
+    enum class Kind { PLAYER, ENEMY, BULLET };
+    PrefabRegistry<Kind> registry;
+    registry.add(Kind::BULLET, Prefab("bullet")).with(Velocity(8.f, 0.f));
+
+    EXPECT_TRUE(registry.has(Kind::BULLET));
+    EXPECT_FALSE(registry.has(Kind::PLAYER));
+    EXPECT_FLOAT_EQ(registry.get(Kind::BULLET).get<Velocity>()->vx, 8.f);
+    EXPECT_THROW(registry.get(Kind::ENEMY), Error);
+}
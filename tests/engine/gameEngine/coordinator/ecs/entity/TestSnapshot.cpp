@@ -0,0 +1,151 @@
+/*
+** EPITECH PROJECT, 2025
+** mirror_rtype
+** File description:
+** test_snapshot
+*/
+
+#include <gtest/gtest.h>
+#include <engine/ecs/entity/EntityManager.hpp>
+#include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/component/Components.hpp>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+class MoverSystem : public System {};
+
+struct Tag {
+    std::string label;
+    std::vector<int> values;
+};
+
+} // namespace
+
+TEST(SnapshotTest, RestoreRollsBackComponentsAndAllocators) {
+    EntityManager em;
+    em.registerComponent<Transform>();
+    em.registerComponent<Tag>();
+
+    Entity a = em.spawnEntity("a");
+    em.emplaceComponent<Transform>(a, 1.f, 2.f, 0.f, 1.f);
+    em.addComponent<Tag>(a, Tag{"ship", {1, 2, 3}});
+    Entity dead = em.spawnEntity("dead");
+    em.killEntity(dead);
+
+    SnapshotHandle handle = em.saveState();
+
+    em.tryGetComponent<Transform>(a)->x = 50.f;
+    em.tryGetComponent<Tag>(a)->values.push_back(4);
+    em.removeComponent<Transform>(a);
+    Entity b = em.spawnEntity("b");
+    em.emplaceComponent<Transform>(b, 9.f, 9.f, 0.f, 1.f);
+
+    em.restoreState(handle);
+
+    EXPECT_TRUE(em.isAlive(a));
+    EXPECT_FALSE(em.isAlive(b));
+    ASSERT_NE(em.tryGetComponent<Transform>(a), nullptr);
+    EXPECT_FLOAT_EQ(em.tryGetComponent<Transform>(a)->x, 1.f);
+    EXPECT_EQ(em.tryGetComponent<Tag>(a)->values.size(), 3u);
+    EXPECT_EQ(em.getComponents<Transform>().packedSize(), 1u);
+    EXPECT_FALSE(em.hasComponent<Transform>(b));
+    EXPECT_EQ(em.getLocalEntities().size(), 1u);
+
+    // The recycled ID is handed out again, as it was at save time
+    Entity again = em.spawnEntity("again");
+    EXPECT_EQ(static_cast<size_t>(again), static_cast<size_t>(dead));
+}
+
+TEST(SnapshotTest, RestoreRematchesOnlyChangedEntities) {
+    EntityManager em;
+    SystemManager sm;
+    em.setSystemManager(&sm);
+    em.registerComponent<Transform>();
+    em.registerComponent<Velocity>();
+
+    auto& mover = sm.addSystem<MoverSystem>();
+    Signature sig;
+    sig.set(em.getComponentTypeId<Transform>());
+    sig.set(em.getComponentTypeId<Velocity>());
+    sm.setSignature<MoverSystem>(sig);
+
+    Entity moving = em.spawnEntity("moving");
+    em.emplaceComponent<Transform>(moving, 0.f, 0.f, 0.f, 1.f);
+    em.emplaceComponent<Velocity>(moving, 1.f, 0.f);
+    SnapshotHandle handle = em.saveState();
+
+    em.removeComponent<Velocity>(moving);
+    Entity spawned = em.spawnEntity("spawned");
+    em.emplaceComponent<Transform>(spawned, 0.f, 0.f, 0.f, 1.f);
+    em.emplaceComponent<Velocity>(spawned, 1.f, 0.f);
+    EXPECT_FALSE(mover.hasEntity(moving));
+    EXPECT_TRUE(mover.hasEntity(spawned));
+
+    em.restoreState(handle);
+
+    EXPECT_TRUE(mover.hasEntity(moving));
+    EXPECT_FALSE(mover.hasEntity(spawned));
+    EXPECT_EQ(mover.entityCount(), 1u);
+    EXPECT_EQ((em.view<Transform, Velocity>().size()), 1u);
+}
+
+TEST(SnapshotTest, RingOverwritesTheOldestSnapshot) {
+    EntityManager em;
+    em.registerComponent<Health>();
+    em.setSnapshotCapacity(2);
+    Entity e = em.spawnEntity("e");
+    em.emplaceComponent<Health>(e, 10, 10);
+
+    SnapshotHandle first = em.saveState();
+    em.tryGetComponent<Health>(e)->currentHealth = 5;
+    SnapshotHandle second = em.saveState();
+    em.tryGetComponent<Health>(e)->currentHealth = 1;
+    em.saveState();
+
+    EXPECT_THROW(em.restoreState(first), Error);
+    EXPECT_THROW(em.restoreState(SnapshotHandle{}), Error);
+    em.restoreState(second);
+    EXPECT_EQ(em.tryGetComponent<Health>(e)->currentHealth, 5);
+    // A snapshot can be restored any number of times
+    em.tryGetComponent<Health>(e)->currentHealth = 0;
+    em.restoreState(second);
+    EXPECT_EQ(em.tryGetComponent<Health>(e)->currentHealth, 5);
+}
+
+TEST(SnapshotTest, PoolsRegisteredAfterTheSaveAreEmptied) {
+    EntityManager em;
+    Entity e = em.spawnEntity("e");
+    SnapshotHandle handle = em.saveState();
+
+    em.registerComponent<Velocity>();
+    em.emplaceComponent<Velocity>(e, 1.f, 1.f);
+    em.restoreState(handle);
+
+    EXPECT_FALSE(em.hasComponent<Velocity>(e));
+    EXPECT_EQ(em.getSignature(e), Signature());
+}
+
+TEST(SnapshotTest, ArchetypeModeIsRejected) {
+    EntityManager em(StorageMode::ARCHETYPE);
+    EXPECT_THROW(em.saveState(), Error);
+}
+
+TEST(SnapshotTest, ResourcesAreRolledBack) {
+    EntityManager em;
+    em.insertResource<Tag>(Tag{"config", {1}});
+    SnapshotHandle handle = em.saveState();
+
+    em.getResource<Tag>().values.push_back(2);
+    em.insertResource<ScoreBoard>().score = 7;
+    em.restoreState(handle);
+
+    EXPECT_EQ(em.getResource<Tag>().values, std::vector<int>{1});
+    EXPECT_FALSE(em.hasResource<ScoreBoard>());
+
+    em.removeResource<Tag>();
+    em.restoreState(handle);
+    EXPECT_EQ(em.getResource<Tag>().label, "config");
+}
@@ -10,10 +10,8 @@
 
 class TestableSystem : public System {
 public:
-    void addEntity(size_t id) { _entities.push_back(id); }
-    void removeEntity(size_t id) {
-        _entities.erase(std::remove(_entities.begin(), _entities.end(), id), _entities.end());
-    }
+    void addEntity(size_t id) { _entities.insert(id); }
+    void removeEntity(size_t id) { _entities.erase(id); }
 
     using System::onCreate;
     using System::onStartRunning;
@@ -84,6 +82,33 @@ TEST(SystemTest, RemoveNonExistingEntityDoesNothing)
     EXPECT_EQ(sys.entityCount(), 1u);
 }
 
+TEST(SystemTest, AddSameEntityTwiceKeepsOneEntry)
+{
+    TestableSystem sys;
+
+    sys.addEntity(4);
+    sys.addEntity(4);
+
+    EXPECT_EQ(sys.entityCount(), 1u);
+}
+
+TEST(SystemTest, RemoveSwapsLastEntityIntoHole)
+{
+    TestableSystem sys;
+
+    sys.addEntity(1);
+    sys.addEntity(2);
+    sys.addEntity(3);
+
+    sys.removeEntity(1);
+    sys.removeEntity(3);
+
+    EXPECT_FALSE(sys.hasEntity(1));
+    EXPECT_TRUE(sys.hasEntity(2));
+    EXPECT_FALSE(sys.hasEntity(3));
+    EXPECT_EQ(sys.entityCount(), 1u);
+}
+
 TEST(SystemTest, LifecycleMethodsAreCallable)
 {
     TestableSystem sys;
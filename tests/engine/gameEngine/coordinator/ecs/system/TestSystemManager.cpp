@@ -7,10 +7,17 @@
 
 #include <gtest/gtest.h>
 #include <engine/ecs/system/SystemManager.hpp>
+#include <engine/ecs/system/SystemPipeline.hpp>
 #include <engine/ecs/system/System.hpp>
 #include <engine/ecs/entity/EntityManager.hpp>
 #include <engine/ecs/component/Components.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 class DummySystem : public System {
 public:
     void onCreate() override { created = true; }
@@ -220,3 +227,452 @@ TEST(SystemManagerTest, EntitySignatureChangedAddsAndRemovesEntity)
     manager.entitySignatureChanged(42, nonMatchingSig);
     EXPECT_FALSE(sys.hasEntity(42));
 }
+
+TEST(SystemManagerTest, EntitySignatureChangedSkipsUnchangedMatches)
+{
+    SystemManager manager;
+    manager.addSystem<DummySystem>();
+    manager.addSystem<AnotherSystem>();
+
+    Signature dummySig;
+    dummySig.set(1);
+    manager.setSignature<DummySystem>(dummySig);
+
+    Signature anotherSig;
+    anotherSig.set(2);
+    manager.setSignature<AnotherSystem>(anotherSig);
+
+    Signature entitySig;
+    entitySig.set(1);
+    manager.entitySignatureChanged(7, entitySig);
+    entitySig.set(3);
+    manager.entitySignatureChanged(7, entitySig);
+
+    auto &dummy = manager.getSystem<DummySystem>();
+    auto &another = manager.getSystem<AnotherSystem>();
+    EXPECT_TRUE(dummy.hasEntity(7));
+    EXPECT_EQ(dummy.entityCount(), 1u);
+    EXPECT_FALSE(another.hasEntity(7));
+
+    entitySig.set(2);
+    manager.entitySignatureChanged(7, entitySig);
+    EXPECT_TRUE(dummy.hasEntity(7));
+    EXPECT_TRUE(another.hasEntity(7));
+
+    manager.entitySignatureChanged(7, Signature());
+    EXPECT_EQ(dummy.entityCount(), 0u);
+    EXPECT_EQ(another.entityCount(), 0u);
+}
+
+TEST(SystemManagerTest, DeletedSystemSlotIsReusedWithoutStaleMembership)
+{
+    SystemManager manager;
+    manager.addSystem<DummySystem>();
+
+    Signature sig;
+    sig.set(1);
+    manager.setSignature<DummySystem>(sig);
+    manager.entitySignatureChanged(5, sig);
+
+    manager.deleteSystem<DummySystem>();
+    auto &another = manager.addSystem<AnotherSystem>();
+    manager.setSignature<AnotherSystem>(sig);
+
+    manager.entitySignatureChanged(5, sig);
+    EXPECT_TRUE(another.hasEntity(5));
+}
+
+namespace {
+
+template <int N>
+class OrderedSystem : public System {
+public:
+    explicit OrderedSystem(std::vector<int>& log) : _log(log) {}
+    void onUpdate(float) override { _log.push_back(N); }
+
+private:
+    std::vector<int>& _log;
+};
+
+template <int N>
+class CountingSystem : public System {
+public:
+    void onUpdate(float) override
+    {
+        ++updateCount;
+        if (fail)
+            throw std::runtime_error("system failure");
+    }
+
+    std::atomic<int> updateCount{0};
+    bool fail = false;
+};
+
+Signature bits(std::initializer_list<size_t> list)
+{
+    Signature sig;
+    for (size_t bit : list)
+        sig.set(bit);
+    return sig;
+}
+
+} // namespace
+
+TEST(SystemManagerTest, UpdateAllRunsSystemsInRegistrationOrder)
+{
+    SystemManager manager;
+    std::vector<int> log;
+    manager.addSystem<OrderedSystem<3>>(log);
+    manager.addSystem<OrderedSystem<1>>(log);
+    manager.addSystem<OrderedSystem<2>>(log);
+
+    manager.updateAll(0.016f);
+
+    EXPECT_EQ(log, (std::vector<int>{3, 1, 2}));
+}
+
+TEST(SystemManagerTest, BatchesGroupSystemsWithDisjointAccess)
+{
+    SystemManager manager;
+    manager.addSystem<CountingSystem<0>>();
+    manager.addSystem<CountingSystem<1>>();
+    manager.addSystem<CountingSystem<2>>();
+    manager.addSystem<CountingSystem<3>>();
+
+    manager.setWrites<CountingSystem<0>>(bits({0}));
+    manager.setWrites<CountingSystem<1>>(bits({1}));
+    manager.setReads<CountingSystem<1>>(bits({2}));
+    // CountingSystem<2> declares nothing: it runs alone
+    manager.setReads<CountingSystem<3>>(bits({0, 2}));
+
+    const auto& batches = manager.getBatches();
+    ASSERT_EQ(batches.size(), 3u);
+    EXPECT_EQ(batches[0], (std::vector<size_t>{0, 1}));
+    EXPECT_EQ(batches[1], (std::vector<size_t>{2}));
+    EXPECT_EQ(batches[2], (std::vector<size_t>{3}));
+}
+
+TEST(SystemManagerTest, ParallelUpdateRunsEverySystemOncePerBatch)
+{
+    SystemManager manager;
+    manager.setSchedulerMode(SchedulerMode::PARALLEL, 3);
+    auto& a = manager.addSystem<CountingSystem<0>>();
+    auto& b = manager.addSystem<CountingSystem<1>>();
+    auto& c = manager.addSystem<CountingSystem<2>>();
+    manager.setWrites<CountingSystem<0>>(bits({0}));
+    manager.setWrites<CountingSystem<1>>(bits({1}));
+    manager.setWrites<CountingSystem<2>>(bits({2}));
+
+    int syncs = 0;
+    manager.setSyncPoint([&syncs]() { ++syncs; });
+
+    for (int frame = 0; frame < 100; ++frame)
+        manager.updateAll(0.016f);
+
+    EXPECT_EQ(a.updateCount.load(), 100);
+    EXPECT_EQ(b.updateCount.load(), 100);
+    EXPECT_EQ(c.updateCount.load(), 100);
+    EXPECT_EQ(syncs, 100);
+}
+
+TEST(SystemManagerTest, ParallelUpdateRethrowsAfterTheBatch)
+{
+    SystemManager manager;
+    manager.setSchedulerMode(SchedulerMode::PARALLEL, 2);
+    auto& a = manager.addSystem<CountingSystem<0>>();
+    auto& b = manager.addSystem<CountingSystem<1>>();
+    manager.setWrites<CountingSystem<0>>(bits({0}));
+    manager.setWrites<CountingSystem<1>>(bits({1}));
+    b.fail = true;
+
+    EXPECT_THROW(manager.updateAll(0.016f), std::runtime_error);
+    EXPECT_EQ(a.updateCount.load(), 1);
+    EXPECT_EQ(b.updateCount.load(), 1);
+}
+
+TEST(SystemManagerTest, RunParallelWithoutTasksReturnsAtOnce)
+{
+    SystemManager manager;
+    manager.setSchedulerMode(SchedulerMode::PARALLEL, 2);
+
+    std::atomic<int> calls{0};
+    manager.runParallel(nullptr, 0, [&calls](size_t) { ++calls; });
+
+    EXPECT_EQ(calls.load(), 0);
+}
+
+TEST(SystemManagerTest, UpdateAllRunsStagesInOrder)
+{
+    SystemManager manager;
+    std::vector<int> log;
+    manager.addSystem<OrderedSystem<5>>(SystemStage::RENDER, log);
+    manager.addSystem<OrderedSystem<2>>(log);
+    manager.addSystem<OrderedSystem<3>>(SystemStage::PHYSICS, log);
+    manager.addSystem<OrderedSystem<0>>(SystemStage::INPUT, log);
+    manager.addSystem<OrderedSystem<4>>(SystemStage::PHYSICS, log);
+    manager.addSystem<OrderedSystem<1>>(SystemStage::INPUT, log);
+
+    manager.updateAll(0.016f);
+
+    EXPECT_EQ(log, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST(SystemManagerTest, BatchesNeverSpanStages)
+{
+    SystemManager manager;
+    manager.addSystem<CountingSystem<0>>(SystemStage::SIMULATION);
+    manager.addSystem<CountingSystem<1>>(SystemStage::PHYSICS);
+    manager.addSystem<CountingSystem<2>>(SystemStage::SIMULATION);
+    manager.setWrites<CountingSystem<0>>(bits({0}));
+    manager.setWrites<CountingSystem<1>>(bits({1}));
+    manager.setWrites<CountingSystem<2>>(bits({2}));
+
+    const auto& batches = manager.getBatches();
+    ASSERT_EQ(batches.size(), 2u);
+    EXPECT_EQ(batches[0], (std::vector<size_t>{0, 1}));
+    EXPECT_EQ(batches[1], (std::vector<size_t>{2}));
+}
+
+TEST(SystemManagerTest, FixedRateStageRunsOncePerStep)
+{
+    SystemManager manager;
+    auto& ai = manager.addSystem<DummySystem>(SystemStage::SIMULATION);
+    auto& render = manager.addSystem<AnotherSystem>(SystemStage::RENDER);
+    manager.setStageRate(SystemStage::SIMULATION, 5.f);
+
+    for (int frame = 0; frame < 60; ++frame)
+        manager.updateAll(1.f / 60.f);
+
+    EXPECT_GE(ai.updateCount, 4);
+    EXPECT_LE(ai.updateCount, 5);
+    EXPECT_FLOAT_EQ(ai.lastDt, 0.2f);
+    EXPECT_EQ(render.updateCount, 60);
+}
+
+TEST(SystemManagerTest, FixedRateSystemCatchesUpWithinLimit)
+{
+    SystemManager manager;
+    auto& ai = manager.addSystem<DummySystem>();
+    manager.setRate<DummySystem>(10.f);
+
+    manager.updateAll(0.05f);
+    EXPECT_EQ(ai.updateCount, 0);
+    manager.updateAll(0.3f);
+    EXPECT_EQ(ai.updateCount, 3);
+    manager.updateAll(10.f);
+    EXPECT_EQ(ai.updateCount, 3 + static_cast<int>(FixedRate::MAX_STEPS));
+    manager.updateAll(0.05f);
+    EXPECT_EQ(ai.updateCount, 3 + static_cast<int>(FixedRate::MAX_STEPS));
+    EXPECT_THROW(manager.setRate<AnotherSystem>(10.f), Error);
+}
+
+TEST(SystemManagerTest, RoutedChangeOnlyRetestsDependentSystems)
+{
+    SystemManager manager;
+    auto &sys1 = manager.addSystem<DummySystem>();
+    auto &sys2 = manager.addSystem<AnotherSystem>();
+
+    Signature first;
+    first.set(0);
+    Signature second;
+    second.set(1);
+    manager.setSignature<DummySystem>(first);
+    manager.setSignature<AnotherSystem>(second);
+
+    Signature entitySig;
+    entitySig.set(0);
+    entitySig.set(1);
+    // Only component 0 is reported as changed: the system on component 1 is not re-tested
+    manager.entitySignatureChanged(7, entitySig, first);
+    EXPECT_TRUE(sys1.hasEntity(7));
+    EXPECT_FALSE(sys2.hasEntity(7));
+
+    manager.entitySignatureChanged(7, entitySig, second);
+    EXPECT_TRUE(sys2.hasEntity(7));
+
+    manager.entitySignatureChanged(7, second, first);
+    EXPECT_FALSE(sys1.hasEntity(7));
+    EXPECT_TRUE(sys2.hasEntity(7));
+}
+
+class IntegrateSystem : public System {
+public:
+    using Components = ComponentList<Transform, Velocity>;
+
+    explicit IntegrateSystem(std::vector<int>& log) : _log(log) {}
+
+    void update(float dt, View<Transform, Velocity>& view)
+    {
+        _log.push_back(1);
+        view.each([dt](size_t, Transform& t, Velocity& v) { t.x += v.vx * dt; });
+    }
+
+    void onUpdate(float) override { ADD_FAILURE() << "the pipeline must call update()"; }
+
+private:
+    std::vector<int>& _log;
+};
+
+class LogSystem : public System {
+public:
+    explicit LogSystem(std::vector<int>& log) : _log(log) {}
+
+    void onUpdate(float) override { _log.push_back(2); }
+
+private:
+    std::vector<int>& _log;
+};
+
+TEST(SystemManagerTest, PipelineRunsAttachedSystemsInOrder)
+{
+    SystemManager manager;
+    EntityManager em;
+    em.setSystemManager(&manager);
+    em.registerComponent<Transform>();
+    em.registerComponent<Velocity>();
+
+    std::vector<int> log;
+    {
+        SystemPipeline<LogSystem, IntegrateSystem> pipeline(em, manager,
+            std::forward_as_tuple(log), std::forward_as_tuple(log));
+        EXPECT_EQ(&manager.getSystem<IntegrateSystem>(), &pipeline.get<IntegrateSystem>());
+        Signature transformOnly;
+        transformOnly.set(EntityManager::getComponentTypeId<Transform>());
+        manager.setSignature<LogSystem>(transformOnly);
+
+        Entity moving = em.spawnEntity("moving");
+        em.emplaceComponent<Transform>(moving, 0.f, 0.f, 0.f, 1.f);
+        em.emplaceComponent<Velocity>(moving, 10.f, 0.f);
+        Entity still = em.spawnEntity("still");
+        em.emplaceComponent<Transform>(still, 0.f, 0.f, 0.f, 1.f);
+        // The signature comes from Components and the list is maintained after construction
+        EXPECT_TRUE(pipeline.get<IntegrateSystem>().hasEntity(static_cast<size_t>(moving)));
+        EXPECT_FALSE(pipeline.get<IntegrateSystem>().hasEntity(static_cast<size_t>(still)));
+
+        manager.updateAll(0.5f);
+        EXPECT_TRUE(log.empty());
+
+        pipeline.update(0.5f);
+        EXPECT_EQ(log, (std::vector<int>{2, 1}));
+        EXPECT_FLOAT_EQ(em.getComponent<Transform>(moving)->x, 5.f);
+    }
+    EXPECT_FALSE(manager.hasSystem<IntegrateSystem>());
+    EXPECT_FALSE(manager.hasSystem<LogSystem>());
+}
+
+TEST(SystemManagerTest, PipelineFlushesTheSyncPointAfterEachSystem)
+{
+    SystemManager manager;
+    EntityManager em;
+    em.setSystemManager(&manager);
+    em.registerComponent<Transform>();
+    em.registerComponent<Velocity>();
+
+    std::vector<int> log;
+    manager.setSyncPoint([&log]() { log.push_back(0); });
+    SystemPipeline<LogSystem, IntegrateSystem> pipeline(em, manager,
+        std::forward_as_tuple(log), std::forward_as_tuple(log));
+
+    pipeline.update(0.f);
+    EXPECT_EQ(log, (std::vector<int>{2, 0, 1, 0}));
+    EXPECT_THROW(manager.attachSystem<LogSystem>(pipeline.get<LogSystem>()), Error);
+}
+
+TEST(SystemManagerTest, ParallelPipelineBatchesSystemsByDeclaredAccess)
+{
+    SystemManager manager;
+    EntityManager em;
+    em.setSystemManager(&manager);
+    manager.setSchedulerMode(SchedulerMode::PARALLEL, 2);
+
+    int syncs = 0;
+    manager.setSyncPoint([&syncs]() { ++syncs; });
+    SystemPipeline<CountingSystem<0>, CountingSystem<1>, CountingSystem<2>> pipeline(em, manager,
+        std::forward_as_tuple(), std::forward_as_tuple(), std::forward_as_tuple());
+    manager.setWrites<CountingSystem<0>>(bits({0}));
+    manager.setWrites<CountingSystem<1>>(bits({1}));
+    // CountingSystem<2> declares nothing: it runs alone, after the first batch
+
+    for (int frame = 0; frame < 50; ++frame)
+        pipeline.update(0.016f);
+
+    EXPECT_EQ(pipeline.get<CountingSystem<0>>().updateCount.load(), 50);
+    EXPECT_EQ(pipeline.get<CountingSystem<1>>().updateCount.load(), 50);
+    EXPECT_EQ(pipeline.get<CountingSystem<2>>().updateCount.load(), 50);
+    EXPECT_EQ(syncs, 100);
+
+    pipeline.get<CountingSystem<1>>().fail = true;
+    EXPECT_THROW(pipeline.update(0.016f), std::runtime_error);
+    EXPECT_EQ(pipeline.get<CountingSystem<0>>().updateCount.load(), 51);
+}
+
+namespace {
+
+class ViewBuildingSystem : public System {
+public:
+    explicit ViewBuildingSystem(EntityManager& em) : _em(em) {}
+
+    void onUpdate(float) override
+    {
+        // Each new signature registers a query slot while the other system of the batch is between two steps
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        seen += _em.view<Transform>().size();
+        seen += _em.view<Velocity>().size();
+        seen += _em.view<Health>().size();
+        seen += _em.view<Transform, Velocity>().size();
+        seen += _em.view<Transform, Health>().size();
+        seen += _em.view<Velocity, Health>().size();
+        seen += _em.view<Transform, Velocity, Health>().size();
+    }
+
+    size_t seen = 0;
+
+private:
+    EntityManager& _em;
+};
+
+class SlowStepSystem : public System {
+public:
+    void onUpdate(float) override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++updateCount;
+    }
+
+    std::atomic<int> updateCount{0};
+};
+
+} // namespace
+
+TEST(SystemManagerTest, ParallelViewCreationKeepsFixedRateSlotsValid)
+{
+    SystemManager manager;
+    EntityManager em;
+    em.setSystemManager(&manager);
+    em.registerComponent<Transform>();
+    em.registerComponent<Velocity>();
+    em.registerComponent<Health>();
+    manager.setSchedulerMode(SchedulerMode::PARALLEL, 2);
+
+    for (int i = 0; i < 64; ++i) {
+        Entity e = em.spawnEntity("entity");
+        em.emplaceComponent<Transform>(e, 0.f, 0.f, 0.f, 1.f);
+        em.emplaceComponent<Velocity>(e, 1.f, 0.f);
+        em.emplaceComponent<Health>(e, 10, 10);
+    }
+
+    auto& views = manager.addSystem<ViewBuildingSystem>(em);
+    auto& fast = manager.addSystem<SlowStepSystem>();
+    manager.setReads<ViewBuildingSystem>(bits({EntityManager::getComponentTypeId<Transform>(),
+        EntityManager::getComponentTypeId<Velocity>(), EntityManager::getComponentTypeId<Health>()}));
+    manager.setWrites<SlowStepSystem>(bits({MAX_COMPONENTS - 1}));
+    manager.setRate<SlowStepSystem>(240.f);
+    ASSERT_EQ(manager.getBatches().size(), 1u);
+
+    for (int frame = 0; frame < 10; ++frame)
+        manager.updateAll(1.f / 60.f);
+
+    EXPECT_EQ(views.seen, 10u * 7u * 64u);
+    EXPECT_GE(fast.updateCount.load(), 38);
+    EXPECT_LE(fast.updateCount.load(), 40);
+}
@@ -106,6 +106,19 @@ public:
         return components[index];
     }
 
+    template <typename T, typename... Args>
+    T& insertResource(Args&&... args) {
+        static_assert(std::is_same_v<T, GameConfig>, "The stub only stores the GameConfig resource");
+        _config.reset();
+        return _config.emplace(std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    T* tryGetResource() {
+        static_assert(std::is_same_v<T, GameConfig>, "The stub only stores the GameConfig resource");
+        return _config ? &*_config : nullptr;
+    }
+
     Entity getEntityFromId(uint32_t id) {
         return Entity::fromId(id);
     }
@@ -221,6 +234,7 @@ private:
     bool leftClickReleased = false;
 
     std::vector<std::optional<GameConfig>> _configs;
+    std::optional<GameConfig> _config;
     std::vector<std::optional<Transform>> _transforms;
     std::vector<std::optional<Sprite>> _sprites;
     std::vector<std::optional<Text>> _texts;